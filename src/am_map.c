@@ -154,10 +154,17 @@ typedef struct
     mpoint_t    b;
 } mline_t;
 
-static unsigned int mapwidth = SCREENWIDTH;
-static unsigned int mapheight = SCREENHEIGHT - SBARHEIGHT;
-static unsigned int maparea = SCREENWIDTH * (SCREENHEIGHT - SBARHEIGHT);
-static unsigned int mapbottom = SCREENWIDTH * (SCREENHEIGHT - SBARHEIGHT - 1);
+// a vertex translated into frame-buffer coordinates
+typedef struct
+{
+    int         x, y;
+    int         stamp;
+} fpoint_t;
+
+static unsigned int mapwidth;
+static unsigned int mapheight;
+static unsigned int maparea;
+static unsigned int mapbottom;
 
 dboolean            automapactive;
 
@@ -220,6 +227,18 @@ am_frame_t          am_frame;
 
 static dboolean     isteleportline[NUMLINESPECIALS];
 
+// vertexes in frame-buffer coordinates, reused until the automap pans, zooms or rotates
+static fpoint_t     *fvertexes;
+static int          fvertexstamp = 1;
+
+static dboolean     allmap;
+static dboolean     cheating;
+
+// lines to be translated, clipped and drawn together by AM_DrawMlines()
+static mline_t      *mlines;
+static int          nummlines;
+static int          nummlines_max;
+
 static void AM_Rotate(fixed_t *x, fixed_t *y, angle_t angle);
 static void (*putbigdot)(unsigned int, unsigned int, byte *);
 static void PUTDOT(unsigned int x, unsigned int y, byte *color);
@@ -394,6 +413,7 @@ void AM_Init(void)
 {
     AM_SetColors();
     AM_GetGridSize();
+    AM_SetAutomapSize();
 
     isteleportline[W1_Teleport] = true;
     isteleportline[W1_ExitLevel] = true;
@@ -409,6 +429,8 @@ void AM_Init(void)
 
 void AM_SetAutomapSize(void)
 {
+    mapwidth = SCREENWIDTH;
+
     if (vid_widescreen || !menuactive)
     {
         mapheight = SCREENHEIGHT - SBARHEIGHT;
@@ -1176,6 +1198,26 @@ static void AM_RotatePoint(mpoint_t *point)
     point->x = temp;
 }
 
+//
+// Rotate many points at once around the center of the automap.
+//
+static void AM_RotatePoints(mpoint_t *points, const int count)
+{
+    const fixed_t   x = am_frame.center.x;
+    const fixed_t   y = am_frame.center.y;
+    const fixed_t   sine = am_frame.sin;
+    const fixed_t   cosine = am_frame.cos;
+
+    for (int i = 0; i < count; i++)
+    {
+        const fixed_t   px = points[i].x - x;
+        const fixed_t   py = points[i].y - y;
+
+        points[i].x = FixedMul(px, cosine) - FixedMul(py, sine) + x;
+        points[i].y = FixedMul(px, sine) + FixedMul(py, cosine) + y;
+    }
+}
+
 //
 // Zooming
 //
@@ -1298,6 +1340,184 @@ static dboolean AM_ClipMline(int *x0, int *y0, int *x1, int *y1)
     return !(outcode1 & outcode2);
 }
 
+//
+// Trivially reject lines already in frame-buffer coordinates that are entirely offscreen.
+//
+static dboolean AM_ClipFline(const int x0, const int y0, const int x1, const int y1)
+{
+    if ((x0 < 0 && x1 < 0) || (x0 >= (int)mapwidth && x1 >= (int)mapwidth)
+        || (y0 < 0 && y1 < 0) || (y0 >= (int)mapheight && y1 >= (int)mapheight))
+        return false;
+
+    return ((x0 - x1) | (y0 - y1));
+}
+
+//
+// Cohen-Sutherland clipping of a line in frame-buffer coordinates to the edges of the automap, so it
+// can be drawn without checking the bounds of every pixel.
+//
+static int AM_Outcode(const int x, const int y)
+{
+    enum
+    {
+        LEFT = 1,
+        RIGHT = 2,
+        TOP = 4,
+        BOTTOM = 8
+    };
+
+    return ((x < 0 ? LEFT : (x >= (int)mapwidth ? RIGHT : 0)) | (y < 0 ? TOP : (y >= (int)mapheight ? BOTTOM : 0)));
+}
+
+static dboolean AM_ClipFlineToFrame(int *x0, int *y0, int *x1, int *y1)
+{
+    int outcode0 = AM_Outcode(*x0, *y0);
+    int outcode1 = AM_Outcode(*x1, *y1);
+
+    while (true)
+    {
+        int         outcode;
+        int64_t     dx, dy;
+        int         x, y;
+
+        if (!(outcode0 | outcode1))
+            return true;
+
+        if (outcode0 & outcode1)
+            return false;
+
+        outcode = (outcode0 ? outcode0 : outcode1);
+        dx = (int64_t)*x1 - *x0;
+        dy = (int64_t)*y1 - *y0;
+
+        if (outcode & 4)
+        {
+            x = (int)(*x0 + dx * -*y0 / dy);
+            y = 0;
+        }
+        else if (outcode & 8)
+        {
+            x = (int)(*x0 + dx * ((int64_t)mapheight - 1 - *y0) / dy);
+            y = mapheight - 1;
+        }
+        else if (outcode & 2)
+        {
+            y = (int)(*y0 + dy * ((int64_t)mapwidth - 1 - *x0) / dx);
+            x = mapwidth - 1;
+        }
+        else
+        {
+            y = (int)(*y0 + dy * -*x0 / dx);
+            x = 0;
+        }
+
+        if (outcode == outcode0)
+        {
+            *x0 = x;
+            *y0 = y;
+            outcode0 = AM_Outcode(x, y);
+        }
+        else
+        {
+            *x1 = x;
+            *y1 = y;
+            outcode1 = AM_Outcode(x, y);
+        }
+    }
+}
+
+//
+// Draw a line that has been clipped to the automap. Horizontal and vertical lines are drawn as
+// spans, and no pixel needs its bounds checked.
+//
+static void AM_DrawClippedFline(int x0, int y0, int x1, int y1, byte *color, const dboolean solid)
+{
+    byte    *dot;
+    int     dx, dy;
+
+    if (!AM_ClipFlineToFrame(&x0, &y0, &x1, &y1))
+        return;
+
+    if (y0 == y1)
+    {
+        // horizontal span
+        byte    *end;
+
+        if (x0 > x1)
+            SWAP(x0, x1);
+
+        dot = mapscreen + y0 * mapwidth + x0;
+        end = dot + x1 - x0;
+
+        if (solid)
+            memset(dot, *color, end - dot + 1);
+        else
+            while (dot <= end)
+            {
+                *dot = *(*dot + color);
+                dot++;
+            }
+
+        return;
+    }
+
+    dot = mapscreen + y0 * mapwidth + x0;
+
+    if (x0 == x1)
+    {
+        // vertical span
+        const int   sy = SIGN(y1 - y0) * mapwidth;
+
+        for (int i = ABS(y1 - y0); i >= 0; i--, dot += sy)
+            *dot = (solid ? *color : *(*dot + color));
+
+        return;
+    }
+
+    dx = ABS(x1 - x0);
+    dy = ABS(y1 - y0);
+
+    {
+        const int   sx = SIGN(x1 - x0);
+        const int   sy = SIGN(y1 - y0) * mapwidth;
+
+        *dot = (solid ? *color : *(*dot + color));
+
+        if (dx >= dy)
+        {
+            // x-major line
+            int error = (dy <<= 1) - dx;
+
+            dx <<= 1;
+
+            for (int i = dx >> 1; i > 0; i--)
+            {
+                const int   mask = ~(error >> 31);
+
+                dot += sx + (sy & mask);
+                *dot = (solid ? *color : *(*dot + color));
+                error += dy - (dx & mask);
+            }
+        }
+        else
+        {
+            // y-major line
+            int error = (dx <<= 1) - dy;
+
+            dy <<= 1;
+
+            for (int i = dy >> 1; i > 0; i--)
+            {
+                const int   mask = ~(error >> 31);
+
+                dot += (sx & mask) + sy;
+                *dot = (solid ? *color : *(*dot + color));
+                error += dx - (dy & mask);
+            }
+        }
+    }
+}
+
 static __inline void _PUTDOT(byte *dot, byte *color)
 {
     *dot = *(*dot + color);
@@ -1309,12 +1529,6 @@ static __inline void PUTDOT(unsigned int x, unsigned int y, byte *color)
         _PUTDOT(mapscreen + y + x, color);
 }
 
-static __inline void PUTDOT2(unsigned int x, unsigned int y, byte *color)
-{
-    if (x < mapwidth && y < maparea)
-        *(mapscreen + y + x) = *color;
-}
-
 static __inline void PUTBIGDOT(unsigned int x, unsigned int y, byte *color)
 {
     if (x < mapwidth)
@@ -1460,12 +1674,6 @@ static void AM_DrawMline(int x0, int y0, int x1, int y1, byte *color)
         AM_DrawFline(x0, y0, x1, y1, color, PUTDOT);
 }
 
-static void AM_DrawMline2(int x0, int y0, int x1, int y1, byte *color)
-{
-    if (AM_ClipMline(&x0, &y0, &x1, &y1))
-        AM_DrawFline(x0, y0, x1, y1, color, PUTDOT2);
-}
-
 static void AM_DrawBigMline(int x0, int y0, int x1, int y1, byte *color)
 {
     if (AM_ClipMline(&x0, &y0, &x1, &y1))
@@ -1478,6 +1686,53 @@ static void AM_DrawTransMline(int x0, int y0, int x1, int y1, byte *color)
         AM_DrawFline(x0, y0, x1, y1, color, PUTTRANSDOT);
 }
 
+//
+// Queue a line in map coordinates to be drawn by AM_DrawMlines().
+//
+static void AM_AddMline(const fixed_t x0, const fixed_t y0, const fixed_t x1, const fixed_t y1)
+{
+    if (nummlines >= nummlines_max)
+    {
+        nummlines_max = (nummlines_max ? nummlines_max * 2 : 256);
+        mlines = I_Realloc(mlines, nummlines_max * sizeof(*mlines));
+    }
+
+    mlines[nummlines].a.x = x0;
+    mlines[nummlines].a.y = y0;
+    mlines[nummlines].b.x = x1;
+    mlines[nummlines].b.y = y1;
+    nummlines++;
+}
+
+//
+// Draw all queued lines in one color: rotate all of their endpoints, then translate them into
+// frame-buffer coordinates, then clip and rasterize them.
+//
+static void AM_DrawMlines(byte *color, const dboolean solid, const dboolean rotate)
+{
+    mpoint_t    *points = (mpoint_t *)mlines;
+    const int   numpoints = nummlines * 2;
+
+    if (rotate)
+        AM_RotatePoints(points, numpoints);
+
+    for (int i = 0; i < numpoints; i++)
+    {
+        points[i].x = CXMTOF(points[i].x);
+        points[i].y = CYMTOF(points[i].y);
+    }
+
+    for (int i = 0; i < nummlines; i++)
+    {
+        const mline_t   *ml = &mlines[i];
+
+        if (AM_ClipFline(ml->a.x, ml->a.y, ml->b.x, ml->b.y))
+            AM_DrawClippedFline(ml->a.x, ml->a.y, ml->b.x, ml->b.y, color, solid);
+    }
+
+    nummlines = 0;
+}
+
 //
 // Draws flat (floor/ceiling tile) aligned grid lines.
 //
@@ -1497,19 +1752,9 @@ static void AM_DrawGrid(void)
 
     end = startx + minlen;
 
-    // Draw vertical gridlines
+    // Add vertical gridlines
     for (fixed_t x = start; x < end; x += gridwidth)
-    {
-        mline_t ml = { { x, starty }, { x, starty + minlen } };
-
-        if (am_rotatemode)
-        {
-            AM_RotatePoint(&ml.a);
-            AM_RotatePoint(&ml.b);
-        }
-
-        AM_DrawMline(ml.a.x, ml.a.y, ml.b.x, ml.b.y, gridcolor);
-    }
+        AM_AddMline(x, starty, x, starty + minlen);
 
     // Figure out start of horizontal gridlines
     start = starty;
@@ -1519,116 +1764,162 @@ static void AM_DrawGrid(void)
 
     end = starty + minlen;
 
-    // Draw horizontal gridlines
+    // Add horizontal gridlines
     for (fixed_t y = start; y < end; y += gridheight)
+        AM_AddMline(startx, y, startx + minlen, y);
+
+    AM_DrawMlines(gridcolor, false, am_rotatemode);
+}
+
+//
+// Translates a vertex into frame-buffer coordinates, or uses the result from a previous frame if the
+// automap hasn't panned, zoomed or rotated since.
+//
+static fpoint_t *AM_TransformVertex(const vertex_t *vertex)
+{
+    fpoint_t    *fvertex = &fvertexes[vertex - vertexes];
+
+    if (fvertex->stamp != fvertexstamp)
     {
-        mline_t ml = { { startx, y }, { startx + minlen, y } };
+        mpoint_t    point = { vertex->x >> FRACTOMAPBITS, vertex->y >> FRACTOMAPBITS };
 
-        if (am_rotatemode)
-        {
-            AM_RotatePoint(&ml.a);
-            AM_RotatePoint(&ml.b);
-        }
+        if (am_rotatemode || menuactive)
+            AM_RotatePoint(&point);
 
-        AM_DrawMline(ml.a.x, ml.a.y, ml.b.x, ml.b.y, gridcolor);
+        fvertex->x = CXMTOF(point.x);
+        fvertex->y = CYMTOF(point.y);
+        fvertex->stamp = fvertexstamp;
     }
+
+    return fvertex;
 }
 
-//
-// Determines visible lines, draws them.
-// This is LineDef based, not LineSeg based.
-//
-static void AM_DrawWalls(void)
+static void AM_DrawWallLine(const fpoint_t *a, const fpoint_t *b, byte *color,
+    void (*putdot)(unsigned int, unsigned int, byte *))
+{
+    if (AM_ClipFline(a->x, a->y, b->x, b->y))
+    {
+        if (putdot == PUTDOT)
+            AM_DrawClippedFline(a->x, a->y, b->x, b->y, color, false);
+        else
+            AM_DrawFline(a->x, a->y, b->x, b->y, color, putdot);
+    }
+}
+
+static dboolean AM_DrawWall(line_t *line)
 {
-    const dboolean  allmap = viewplayer->powers[pw_allmap];
-    const dboolean  cheating = viewplayer->cheats & (CF_ALLMAP | CF_ALLMAP_THINGS);
-    int             i = 0;
+    const unsigned short    flags = line->flags;
 
-    while (i < numlines)
+    if ((line->bbox[BOXLEFT] >> FRACTOMAPBITS) > am_frame.bbox[BOXRIGHT]
+        || (line->bbox[BOXRIGHT] >> FRACTOMAPBITS) < am_frame.bbox[BOXLEFT]
+        || (line->bbox[BOXBOTTOM] >> FRACTOMAPBITS) > am_frame.bbox[BOXTOP]
+        || (line->bbox[BOXTOP] >> FRACTOMAPBITS) < am_frame.bbox[BOXBOTTOM])
+        return true;
+
+    if ((flags & ML_DONTDRAW) && !cheating)
+        return true;
+    else
     {
-        const line_t    line = lines[i++];
+        const sector_t          *back = line->backsector;
+        const dboolean          mapped = flags & ML_MAPPED;
+        const dboolean          secret = flags & ML_SECRET;
+        const unsigned short    special = line->special;
+        const fpoint_t          *a;
+        const fpoint_t          *b;
+
+        if (!mapped && !allmap && !cheating)
+            return true;
+
+        a = AM_TransformVertex(line->v1);
+        b = AM_TransformVertex(line->v2);
+
+        if (special
+            && isteleportline[special]
+            && ((flags & ML_TELEPORTTRIGGERED) || cheating || (back && isteleport[back->floorpic])))
+        {
+            if (cheating || (mapped && !secret && back && back->ceilingheight != back->floorheight))
+            {
+                AM_DrawWallLine(a, b, teleportercolor, PUTDOT);
+                return true;
+            }
+            else if (allmap)
+            {
+                AM_DrawWallLine(a, b, allmapfdwallcolor, PUTDOT);
+                return true;
+            }
+        }
 
-        if ((line.bbox[BOXLEFT] >> FRACTOMAPBITS) > am_frame.bbox[BOXRIGHT]
-            || (line.bbox[BOXRIGHT] >> FRACTOMAPBITS) < am_frame.bbox[BOXLEFT]
-            || (line.bbox[BOXBOTTOM] >> FRACTOMAPBITS) > am_frame.bbox[BOXTOP]
-            || (line.bbox[BOXTOP] >> FRACTOMAPBITS) < am_frame.bbox[BOXBOTTOM])
-            continue;
+        if (!back || (secret && !cheating))
+        {
+            if (mapped || cheating)
+                AM_DrawWallLine(a, b, wallcolor, putbigdot);
+            else if (allmap)
+                AM_DrawWallLine(a, b, allmapwallcolor, putbigdot);
+        }
         else
         {
-            const unsigned short    flags = line.flags;
+            const sector_t  *front = line->frontsector;
 
-            if ((flags & ML_DONTDRAW) && !cheating)
-                continue;
-            else
+            if (back->floorheight != front->floorheight)
             {
-                const sector_t          *back = line.backsector;
-                const dboolean          mapped = flags & ML_MAPPED;
-                const dboolean          secret = flags & ML_SECRET;
-                const unsigned short    special = line.special;
-                mline_t                 mline;
-
-                mline.a.x = line.v1->x >> FRACTOMAPBITS;
-                mline.a.y = line.v1->y >> FRACTOMAPBITS;
-                mline.b.x = line.v2->x >> FRACTOMAPBITS;
-                mline.b.y = line.v2->y >> FRACTOMAPBITS;
-
-                if (am_rotatemode || menuactive)
-                {
-                    AM_RotatePoint(&mline.a);
-                    AM_RotatePoint(&mline.b);
-                }
+                if (mapped || cheating)
+                    AM_DrawWallLine(a, b, fdwallcolor, PUTDOT);
+                else if (allmap)
+                    AM_DrawWallLine(a, b, allmapfdwallcolor, PUTDOT);
+            }
+            else if (back->ceilingheight != front->ceilingheight)
+            {
+                if (mapped || cheating)
+                    AM_DrawWallLine(a, b, cdwallcolor, PUTDOT);
+                else if (allmap)
+                    AM_DrawWallLine(a, b, allmapcdwallcolor, PUTDOT);
+            }
+            else if (cheating)
+                AM_DrawWallLine(a, b, tswallcolor, PUTDOT);
+        }
+    }
 
-                if (special
-                    && isteleportline[special]
-                    && ((flags & ML_TELEPORTTRIGGERED) || cheating || (back && isteleport[back->floorpic])))
-                {
-                    if (cheating || (mapped && !secret && back && back->ceilingheight != back->floorheight))
-                    {
-                        AM_DrawMline(mline.a.x, mline.a.y, mline.b.x, mline.b.y, teleportercolor);
-                        continue;
-                    }
-                    else if (allmap)
-                    {
-                        AM_DrawMline(mline.a.x, mline.a.y, mline.b.x, mline.b.y, allmapfdwallcolor);
-                        continue;
-                    }
-                }
+    return true;
+}
 
-                if (!back || (secret && !cheating))
-                {
-                    if (mapped || cheating)
-                        AM_DrawBigMline(mline.a.x, mline.a.y, mline.b.x, mline.b.y, wallcolor);
-                    else if (allmap)
-                        AM_DrawBigMline(mline.a.x, mline.a.y, mline.b.x, mline.b.y, allmapwallcolor);
-                }
-                else
-                {
-                    const sector_t  *front = line.frontsector;
+//
+// Determines visible lines, draws them.
+// This is LineDef based, not LineSeg based.
+//
+static void AM_DrawWalls(void)
+{
+    // blockmap cells overlapping the automap's frame
+    const int   x1 = (int)BETWEEN(0, (((int64_t)am_frame.bbox[BOXLEFT] << FRACTOMAPBITS) - bmaporgx) >> MAPBLOCKSHIFT,
+                    bmapwidth - 1);
+    const int   x2 = (int)BETWEEN(0, (((int64_t)am_frame.bbox[BOXRIGHT] << FRACTOMAPBITS) - bmaporgx) >> MAPBLOCKSHIFT,
+                    bmapwidth - 1);
+    const int   y1 = (int)BETWEEN(0, (((int64_t)am_frame.bbox[BOXBOTTOM] << FRACTOMAPBITS) - bmaporgy) >> MAPBLOCKSHIFT,
+                    bmapheight - 1);
+    const int   y2 = (int)BETWEEN(0, (((int64_t)am_frame.bbox[BOXTOP] << FRACTOMAPBITS) - bmaporgy) >> MAPBLOCKSHIFT,
+                    bmapheight - 1);
+
+    allmap = viewplayer->powers[pw_allmap];
+    cheating = viewplayer->cheats & (CF_ALLMAP | CF_ALLMAP_THINGS);
+
+    if (!fvertexes)
+        fvertexes = Z_Calloc(numvertexes, sizeof(*fvertexes), PU_LEVEL, (void **)&fvertexes);
+
+    // Only look at the lines in the blockmap cells the frame overlaps, unless that is most of them anyway.
+    if ((x2 - x1 + 1) * (y2 - y1 + 1) < bmapwidth * bmapheight / 2)
+    {
+        validcount++;
 
-                    if (back->floorheight != front->floorheight)
-                    {
-                        if (mapped || cheating)
-                            AM_DrawMline(mline.a.x, mline.a.y, mline.b.x, mline.b.y, fdwallcolor);
-                        else if (allmap)
-                            AM_DrawMline(mline.a.x, mline.a.y, mline.b.x, mline.b.y, allmapfdwallcolor);
-                    }
-                    else if (back->ceilingheight != front->ceilingheight)
-                    {
-                        if (mapped || cheating)
-                            AM_DrawMline(mline.a.x, mline.a.y, mline.b.x, mline.b.y, cdwallcolor);
-                        else if (allmap)
-                            AM_DrawMline(mline.a.x, mline.a.y, mline.b.x, mline.b.y, allmapcdwallcolor);
-                    }
-                    else if (cheating)
-                        AM_DrawMline(mline.a.x, mline.a.y, mline.b.x, mline.b.y, tswallcolor);
-                }
-            }
-        }
+        for (int y = y1; y <= y2; y++)
+            for (int x = x1; x <= x2; x++)
+                P_BlockLinesIterator(x, y, AM_DrawWall);
     }
+    else
+        for (int i = 0; i < numlines; i++)
+            AM_DrawWall(&lines[i]);
 }
 
-static void AM_DrawLineCharacter(const mline_t *lineguy, const int lineguylines,
-    const fixed_t scale, angle_t angle, byte color, fixed_t x, fixed_t y)
+static void AM_AddLineCharacter(const mline_t *lineguy, const int lineguylines,
+    const fixed_t scale, angle_t angle, fixed_t x, fixed_t y)
 {
     for (int i = 0; i < lineguylines; i++)
     {
@@ -1657,7 +1948,7 @@ static void AM_DrawLineCharacter(const mline_t *lineguy, const int lineguylines,
             AM_Rotate(&x2, &y2, angle);
         }
 
-        AM_DrawMline2(x + x1, y + y1, x + x2, y + y2, &color);
+        AM_AddMline(x + x1, y + y1, x + x2, y + y2);
     }
 }
 
@@ -1753,12 +2044,18 @@ static void AM_DrawPlayer(void)
         if (invisibility > STARTFLASHING || (invisibility & 8))
             AM_DrawTransLineCharacter(cheatplayerarrow, CHEATPLAYERARROWLINES, 0, angle, &playercolor, point.x, point.y);
         else
-            AM_DrawLineCharacter(cheatplayerarrow, CHEATPLAYERARROWLINES, 0, angle, playercolor, point.x, point.y);
+        {
+            AM_AddLineCharacter(cheatplayerarrow, CHEATPLAYERARROWLINES, 0, angle, point.x, point.y);
+            AM_DrawMlines(&playercolor, true, false);
+        }
     }
     else if (invisibility > STARTFLASHING || (invisibility & 8))
         AM_DrawTransLineCharacter(playerarrow, PLAYERARROWLINES, 0, angle, &playercolor, point.x, point.y);
     else
-        AM_DrawLineCharacter(playerarrow, PLAYERARROWLINES, 0, angle, playercolor, point.x, point.y);
+    {
+        AM_AddLineCharacter(playerarrow, PLAYERARROWLINES, 0, angle, point.x, point.y);
+        AM_DrawMlines(&playercolor, true, false);
+    }
 }
 
 #define THINGTRIANGLELINES  3
@@ -1817,13 +2114,15 @@ static void AM_DrawThings(void)
                     fy = CYMTOF(point.y);
 
                     if (fx >= -w && fx <= (int)mapwidth + w && fy >= -w && fy <= (int)mapheight + w)
-                        AM_DrawLineCharacter(thingtriangle, THINGTRIANGLELINES, w, angle, thingcolor, point.x, point.y);
+                        AM_AddLineCharacter(thingtriangle, THINGTRIANGLELINES, w, angle, point.x, point.y);
                 }
 
                 thing = thing->snext;
             }
         }
     }
+
+    AM_DrawMlines(&thingcolor, true, false);
 }
 
 #define MARKWIDTH   8
@@ -2021,8 +2320,14 @@ static void AM_DrawSolidCrosshair(void)
 
 static void AM_SetFrameVariables(void)
 {
-    const fixed_t   x = m_x + m_w / 2;
-    const fixed_t   y = m_y + m_h / 2;
+    static am_frame_t   prevframe;
+    static fixed_t      prevm_x, prevm_y;
+    static fixed_t      prevscale_mtof;
+    static unsigned int prevmapheight;
+    static dboolean     prevrotate;
+    const fixed_t       x = m_x + m_w / 2;
+    const fixed_t       y = m_y + m_h / 2;
+    const dboolean      rotate = (am_rotatemode || menuactive);
 
     am_frame.center.x = x;
     am_frame.center.y = y;
@@ -2049,6 +2354,19 @@ static void AM_SetFrameVariables(void)
         am_frame.bbox[BOXBOTTOM] = m_y;
         am_frame.bbox[BOXTOP] = m_y2;
     }
+
+    // invalidate the vertexes translated in previous frames if the automap has moved
+    if (m_x != prevm_x || m_y != prevm_y || scale_mtof != prevscale_mtof || mapheight != prevmapheight
+        || rotate != prevrotate || (rotate && memcmp(&am_frame, &prevframe, sizeof(am_frame))))
+    {
+        fvertexstamp++;
+        prevm_x = m_x;
+        prevm_y = m_y;
+        prevscale_mtof = scale_mtof;
+        prevmapheight = mapheight;
+        prevrotate = rotate;
+        prevframe = am_frame;
+    }
 }
 
 void AM_Drawer(void)
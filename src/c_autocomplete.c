@@ -6304,6 +6304,7 @@ autocomplete_t autocompletelist[] =
     { "if r_althud off then ",                       DOOM1AND2 },
     { "if r_althud on ",                             DOOM1AND2 },
     { "if r_althud on then ",                        DOOM1AND2 },
+    { "if r_animupdates ",                           DOOM1AND2 },
     { "if r_berserkintensity ",                      DOOM1AND2 },
     { "if r_blood ",                                 DOOM1AND2 },
     { "if r_blood all ",                             DOOM1AND2 },
@@ -6376,6 +6377,17 @@ autocomplete_t autocompletelist[] =
     { "if r_dither off then ",                       DOOM1AND2 },
     { "if r_dither on ",                             DOOM1AND2 },
     { "if r_dither on then ",                        DOOM1AND2 },
+    { "if r_drawsegtests ",                          DOOM1AND2 },
+    { "if r_drawsegtests_skipped ",                  DOOM1AND2 },
+    { "if r_dynamicresolution ",                     DOOM1AND2 },
+    { "if r_dynamicresolution 60 ",                  DOOM1AND2 },
+    { "if r_dynamicresolution 60 then ",             DOOM1AND2 },
+    { "if r_dynamicresolution off ",                 DOOM1AND2 },
+    { "if r_dynamicresolution off then ",            DOOM1AND2 },
+    { "if r_dynamicresolution_budget ",              DOOM1AND2 },
+    { "if r_dynamicresolution_rendertime ",          DOOM1AND2 },
+    { "if r_dynamicresolution_scale ",               DOOM1AND2 },
+    { "if r_dynamicresolution_step ",                DOOM1AND2 },
     { "if r_fixmaperrors ",                          DOOM1AND2 },
     { "if r_fixmaperrors off ",                      DOOM1AND2 },
     { "if r_fixmaperrors off then ",                 DOOM1AND2 },
@@ -6503,6 +6515,7 @@ autocomplete_t autocompletelist[] =
     { "if r_liquid_swirl off then ",                 DOOM1AND2 },
     { "if r_liquid_swirl on ",                       DOOM1AND2 },
     { "if r_liquid_swirl on then ",                  DOOM1AND2 },
+    { "if r_liquid_warps ",                          DOOM1AND2 },
     { "if r_lowpixelsize ",                          DOOM1AND2 },
     { "if r_lowpixelsize 2x2 ",                      DOOM1AND2 },
     { "if r_lowpixelsize 2x2 then ",                 DOOM1AND2 },
@@ -6511,11 +6524,21 @@ autocomplete_t autocompletelist[] =
     { "if r_mirroredweapons off then ",              DOOM1AND2 },
     { "if r_mirroredweapons on ",                    DOOM1AND2 },
     { "if r_mirroredweapons on then ",               DOOM1AND2 },
+    { "if r_occlusion ",                             DOOM1AND2 },
+    { "if r_occlusion off ",                         DOOM1AND2 },
+    { "if r_occlusion off then ",                    DOOM1AND2 },
+    { "if r_occlusion on ",                          DOOM1AND2 },
+    { "if r_occlusion on then ",                     DOOM1AND2 },
     { "if r_playersprites ",                         DOOM1AND2 },
     { "if r_playersprites off ",                     DOOM1AND2 },
     { "if r_playersprites off then ",                DOOM1AND2 },
     { "if r_playersprites on ",                      DOOM1AND2 },
     { "if r_playersprites on then ",                 DOOM1AND2 },
+    { "if r_pvs ",                                   DOOM1AND2 },
+    { "if r_pvs off ",                               DOOM1AND2 },
+    { "if r_pvs off then ",                          DOOM1AND2 },
+    { "if r_pvs on ",                                DOOM1AND2 },
+    { "if r_pvs on then ",                           DOOM1AND2 },
     { "if r_rockettrails ",                          DOOM1AND2 },
     { "if r_rockettrails off ",                      DOOM1AND2 },
     { "if r_rockettrails off then ",                 DOOM1AND2 },
@@ -6542,6 +6565,11 @@ autocomplete_t autocompletelist[] =
     { "if r_shake_damage 100% then ",                DOOM1AND2 },
     { "if r_shake_damage 50% ",                      DOOM1AND2 },
     { "if r_shake_damage 50% then ",                 DOOM1AND2 },
+    { "if r_showstats ",                             DOOM1AND2 },
+    { "if r_showstats off ",                         DOOM1AND2 },
+    { "if r_showstats off then ",                    DOOM1AND2 },
+    { "if r_showstats on ",                          DOOM1AND2 },
+    { "if r_showstats on then ",                     DOOM1AND2 },
     { "if r_skycolor ",                              DOOM1AND2 },
     { "if r_skycolor black ",                        DOOM1AND2 },
     { "if r_skycolor black then ",                   DOOM1AND2 },
@@ -6585,6 +6613,19 @@ autocomplete_t autocompletelist[] =
     { "if r_skycolor white then ",                   DOOM1AND2 },
     { "if r_skycolor yellow ",                       DOOM1AND2 },
     { "if r_skycolor yellow then ",                  DOOM1AND2 },
+    { "if r_stats_drawsegs ",                        DOOM1AND2 },
+    { "if r_stats_maskedposts ",                     DOOM1AND2 },
+    { "if r_stats_nodes ",                           DOOM1AND2 },
+    { "if r_stats_pvsculled ",                       DOOM1AND2 },
+    { "if r_stats_segs ",                            DOOM1AND2 },
+    { "if r_stats_skycolumns ",                      DOOM1AND2 },
+    { "if r_stats_spanpixels ",                      DOOM1AND2 },
+    { "if r_stats_spriteposts ",                     DOOM1AND2 },
+    { "if r_stats_subsectors ",                      DOOM1AND2 },
+    { "if r_stats_visplanes ",                       DOOM1AND2 },
+    { "if r_stats_visplanes_chain ",                 DOOM1AND2 },
+    { "if r_stats_vissprites ",                      DOOM1AND2 },
+    { "if r_stats_walldraws ",                       DOOM1AND2 },
     { "if r_textures ",                              DOOM1AND2 },
     { "if r_textures off ",                          DOOM1AND2 },
     { "if r_textures off then ",                     DOOM1AND2 },
@@ -6615,6 +6656,8 @@ autocomplete_t autocompletelist[] =
     { "if s_channels 32 then ",                      DOOM1AND2 },
     { "if s_channels 64 ",                           DOOM1AND2 },
     { "if s_channels 64 then ",                      DOOM1AND2 },
+    { "if s_channels 256 ",                          DOOM1AND2 },
+    { "if s_channels 256 then ",                     DOOM1AND2 },
     { "if s_musicvolume ",                           DOOM1AND2 },
     { "if s_musicvolume 100% ",                      DOOM1AND2 },
     { "if s_musicvolume 100% then ",                 DOOM1AND2 },
@@ -6684,6 +6727,7 @@ autocomplete_t autocompletelist[] =
 #if !defined(_WIN32)
     { "if vid_driver ",                              DOOM1AND2 },
 #endif
+    { "if vid_frametimejitter ",                     DOOM1AND2 },
     { "if vid_fullscreen ",                          DOOM1AND2 },
     { "if vid_fullscreen off ",                      DOOM1AND2 },
     { "if vid_fullscreen off then ",                 DOOM1AND2 },
@@ -6769,6 +6813,11 @@ autocomplete_t autocompletelist[] =
     { "if vid_showfps off then ",                    DOOM1AND2 },
     { "if vid_showfps on ",                          DOOM1AND2 },
     { "if vid_showfps on then ",                     DOOM1AND2 },
+    { "if vid_showprofile ",                         DOOM1AND2 },
+    { "if vid_showprofile off ",                     DOOM1AND2 },
+    { "if vid_showprofile off then ",                DOOM1AND2 },
+    { "if vid_showprofile on ",                      DOOM1AND2 },
+    { "if vid_showprofile on then ",                 DOOM1AND2 },
     { "if vid_vsync ",                               DOOM1AND2 },
     { "if vid_vsync off ",                           DOOM1AND2 },
     { "if vid_vsync off then ",                      DOOM1AND2 },
@@ -7219,10 +7268,12 @@ autocomplete_t autocompletelist[] =
     { "playerstats",                                 DOOM1AND2 },
     { "+prevweapon",                                 DOOM1AND2 },
     { "print ",                                      DOOM1AND2 },
+    { "profiledump ",                                DOOM1AND2 },
     { "quit",                                        DOOM1AND2 },
     { "r_althud ",                                   DOOM1AND2 },
     { "r_althud off",                                DOOM1AND2 },
     { "r_althud on",                                 DOOM1AND2 },
+    { "r_animupdates",                               DOOM1AND2 },
     { "r_berserkintensity ",                         DOOM1AND2 },
     { "r_blood ",                                    DOOM1AND2 },
     { "r_blood all",                                 DOOM1AND2 },
@@ -7266,6 +7317,15 @@ autocomplete_t autocompletelist[] =
     { "r_dither ",                                   DOOM1AND2 },
     { "r_dither off",                                DOOM1AND2 },
     { "r_dither on",                                 DOOM1AND2 },
+    { "r_drawsegtests",                              DOOM1AND2 },
+    { "r_drawsegtests_skipped",                      DOOM1AND2 },
+    { "r_dynamicresolution ",                        DOOM1AND2 },
+    { "r_dynamicresolution 60",                      DOOM1AND2 },
+    { "r_dynamicresolution off",                     DOOM1AND2 },
+    { "r_dynamicresolution_budget",                  DOOM1AND2 },
+    { "r_dynamicresolution_rendertime",              DOOM1AND2 },
+    { "r_dynamicresolution_scale",                   DOOM1AND2 },
+    { "r_dynamicresolution_step",                    DOOM1AND2 },
     { "r_fixmaperrors ",                             DOOM1AND2 },
     { "r_fixmaperrors off",                          DOOM1AND2 },
     { "r_fixmaperrors on",                           DOOM1AND2 },
@@ -7334,14 +7394,21 @@ autocomplete_t autocompletelist[] =
     { "r_liquid_swirl ",                             DOOM1AND2 },
     { "r_liquid_swirl off",                          DOOM1AND2 },
     { "r_liquid_swirl on",                           DOOM1AND2 },
+    { "r_liquid_warps",                              DOOM1AND2 },
     { "r_lowpixelsize ",                             DOOM1AND2 },
     { "r_lowpixelsize 2x2",                          DOOM1AND2 },
     { "r_mirroredweapons ",                          DOOM1AND2 },
     { "r_mirroredweapons off",                       DOOM1AND2 },
     { "r_mirroredweapons on",                        DOOM1AND2 },
+    { "r_occlusion ",                                DOOM1AND2 },
+    { "r_occlusion off",                             DOOM1AND2 },
+    { "r_occlusion on",                              DOOM1AND2 },
     { "r_playersprites ",                            DOOM1AND2 },
     { "r_playersprites off",                         DOOM1AND2 },
     { "r_playersprites on",                          DOOM1AND2 },
+    { "r_pvs ",                                      DOOM1AND2 },
+    { "r_pvs off",                                   DOOM1AND2 },
+    { "r_pvs on",                                    DOOM1AND2 },
     { "r_rockettrails ",                             DOOM1AND2 },
     { "r_rockettrails off",                          DOOM1AND2 },
     { "r_rockettrails on",                           DOOM1AND2 },
@@ -7358,6 +7425,9 @@ autocomplete_t autocompletelist[] =
     { "r_shake_damage ",                             DOOM1AND2 },
     { "r_shake_damage 100%",                         DOOM1AND2 },
     { "r_shake_damage 50%",                          DOOM1AND2 },
+    { "r_showstats ",                                DOOM1AND2 },
+    { "r_showstats off",                             DOOM1AND2 },
+    { "r_showstats on",                              DOOM1AND2 },
     { "r_skycolor ",                                 DOOM1AND2 },
     { "r_skycolor black",                            DOOM1AND2 },
     { "r_skycolor blue",                             DOOM1AND2 },
@@ -7380,6 +7450,19 @@ autocomplete_t autocompletelist[] =
     { "r_skycolor tan",                              DOOM1AND2 },
     { "r_skycolor white",                            DOOM1AND2 },
     { "r_skycolor yellow",                           DOOM1AND2 },
+    { "r_stats_drawsegs",                            DOOM1AND2 },
+    { "r_stats_maskedposts",                         DOOM1AND2 },
+    { "r_stats_nodes",                               DOOM1AND2 },
+    { "r_stats_pvsculled",                           DOOM1AND2 },
+    { "r_stats_segs",                                DOOM1AND2 },
+    { "r_stats_skycolumns",                          DOOM1AND2 },
+    { "r_stats_spanpixels",                          DOOM1AND2 },
+    { "r_stats_spriteposts",                         DOOM1AND2 },
+    { "r_stats_subsectors",                          DOOM1AND2 },
+    { "r_stats_visplanes",                           DOOM1AND2 },
+    { "r_stats_visplanes_chain",                     DOOM1AND2 },
+    { "r_stats_vissprites",                          DOOM1AND2 },
+    { "r_stats_walldraws",                           DOOM1AND2 },
     { "r_textures ",                                 DOOM1AND2 },
     { "r_textures off",                              DOOM1AND2 },
     { "r_textures on",                               DOOM1AND2 },
@@ -7465,6 +7548,7 @@ autocomplete_t autocompletelist[] =
     { "reset r_detail",                              DOOM1AND2 },
     { "reset r_diskicon",                            DOOM1AND2 },
     { "reset r_dither",                              DOOM1AND2 },
+    { "reset r_dynamicresolution",                   DOOM1AND2 },
     { "reset r_fixmaperrors",                        DOOM1AND2 },
     { "reset r_fixspriteoffsets",                    DOOM1AND2 },
     { "reset r_floatbob",                            DOOM1AND2 },
@@ -7480,13 +7564,16 @@ autocomplete_t autocompletelist[] =
     { "reset r_liquid_swirl",                        DOOM1AND2 },
     { "reset r_lowpixelsize",                        DOOM1AND2 },
     { "reset r_mirroredweapons",                     DOOM1AND2 },
+    { "reset r_occlusion",                           DOOM1AND2 },
     { "reset r_playersprites",                       DOOM1AND2 },
+    { "reset r_pvs",                                 DOOM1AND2 },
     { "reset r_rockettrails",                        DOOM1AND2 },
     { "reset r_screensize",                          DOOM1AND2 },
     { "reset r_shadows",                             DOOM1AND2 },
     { "reset r_shadows_translucency",                DOOM1AND2 },
     { "reset r_shake_barrels",                       DOOM1AND2 },
     { "reset r_shake_damage",                        DOOM1AND2 },
+    { "reset r_showstats",                           DOOM1AND2 },
     { "reset r_skycolor",                            DOOM1AND2 },
     { "reset r_textures",                            DOOM1AND2 },
     { "reset r_translucency",                        DOOM1AND2 },
@@ -7515,6 +7602,7 @@ autocomplete_t autocompletelist[] =
     { "reset vid_scalefilter",                       DOOM1AND2 },
     { "reset vid_screenresolution",                  DOOM1AND2 },
     { "reset vid_showfps",                           DOOM1AND2 },
+    { "reset vid_showprofile",                       DOOM1AND2 },
     { "reset vid_vsync",                             DOOM1AND2 },
     { "reset vid_widescreen",                        DOOM1AND2 },
     { "reset vid_windowpos",                         DOOM1AND2 },
@@ -7558,6 +7646,7 @@ autocomplete_t autocompletelist[] =
     { "s_channels ",                                 DOOM1AND2 },
     { "s_channels 32",                               DOOM1AND2 },
     { "s_channels 64",                               DOOM1AND2 },
+    { "s_channels 256",                              DOOM1AND2 },
     { "s_musicvolume ",                              DOOM1AND2 },
     { "s_musicvolume 100%",                          DOOM1AND2 },
     { "s_musicvolume 67%",                           DOOM1AND2 },
@@ -7772,6 +7861,7 @@ autocomplete_t autocompletelist[] =
     { "tossdrop ",                                   DOOM1AND2 },
     { "tossdrop off",                                DOOM1AND2 },
     { "tossdrop on",                                 DOOM1AND2 },
+    { "tracebenchmark",                              DOOM1AND2 },
     { "turbo ",                                      DOOM1AND2 },
     { "turbo 10%",                                   DOOM1AND2 },
     { "turbo 100%",                                  DOOM1AND2 },
@@ -7928,6 +8018,7 @@ autocomplete_t autocompletelist[] =
 #if !defined(_WIN32)
     { "vid_driver ",                                 DOOM1AND2 },
 #endif
+    { "vid_frametimejitter",                         DOOM1AND2 },
     { "vid_fullscreen ",                             DOOM1AND2 },
     { "vid_fullscreen off",                          DOOM1AND2 },
     { "vid_fullscreen on",                           DOOM1AND2 },
@@ -7976,6 +8067,9 @@ autocomplete_t autocompletelist[] =
     { "vid_showfps ",                                DOOM1AND2 },
     { "vid_showfps off",                             DOOM1AND2 },
     { "vid_showfps on",                              DOOM1AND2 },
+    { "vid_showprofile ",                            DOOM1AND2 },
+    { "vid_showprofile off",                         DOOM1AND2 },
+    { "vid_showprofile on",                          DOOM1AND2 },
     { "vid_vsync ",                                  DOOM1AND2 },
     { "vid_vsync off",                               DOOM1AND2 },
     { "vid_vsync on",                                DOOM1AND2 },
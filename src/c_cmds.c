@@ -305,6 +305,8 @@ static dboolean play_cmd_func1(char *cmd, char *parms);
 static void play_cmd_func2(char *cmd, char *parms);
 static void playerstats_cmd_func2(char *cmd, char *parms);
 static void print_cmd_func2(char *cmd, char *parms);
+static dboolean profiledump_cmd_func1(char *cmd, char *parms);
+static void profiledump_cmd_func2(char *cmd, char *parms);
 static void quit_cmd_func2(char *cmd, char *parms);
 static void regenhealth_cmd_func2(char *cmd, char *parms);
 static void reset_cmd_func2(char *cmd, char *parms);
@@ -323,6 +325,7 @@ static void take_cmd_func2(char *cmd, char *parms);
 static void teleport_cmd_func2(char *cmd, char *parms);
 static void thinglist_cmd_func2(char *cmd, char *parms);
 static void timer_cmd_func2(char *cmd, char *parms);
+static void tracebenchmark_cmd_func2(char *cmd, char *parms);
 static void unbind_cmd_func2(char *cmd, char *parms);
 static void vanilla_cmd_func2(char *cmd, char *parms);
 
@@ -362,6 +365,8 @@ static void r_color_cvar_func2(char *cmd, char *parms);
 static dboolean r_detail_cvar_func1(char *cmd, char *parms);
 static void r_detail_cvar_func2(char *cmd, char *parms);
 static void r_dither_cvar_func2(char *cmd, char *parms);
+static dboolean r_dynamicresolution_cvar_func1(char *cmd, char *parms);
+static void r_dynamicresolution_cvar_func2(char *cmd, char *parms);
 static void r_fixmaperrors_cvar_func2(char *cmd, char *parms);
 static void r_fov_cvar_func2(char *cmd, char *parms);
 static dboolean r_gamma_cvar_func1(char *cmd, char *parms);
@@ -369,8 +374,10 @@ static void r_gamma_cvar_func2(char *cmd, char *parms);
 static void r_hud_cvar_func2(char *cmd, char *parms);
 static void r_hud_translucency_cvar_func2(char *cmd, char *parms);
 static void r_lowpixelsize_cvar_func2(char *cmd, char *parms);
+static void r_pvs_cvar_func2(char *cmd, char *parms);
 static void r_screensize_cvar_func2(char *cmd, char *parms);
 static void r_shadows_translucency_cvar_func2(char *cmd, char *parms);
+static void r_showstats_cvar_func2(char *cmd, char *parms);
 static dboolean r_skycolor_cvar_func1(char *cmd, char *parms);
 static void r_skycolor_cvar_func2(char *cmd, char *parms);
 static void r_textures_cvar_func2(char *cmd, char *parms);
@@ -395,6 +402,7 @@ static dboolean vid_scalefilter_cvar_func1(char *cmd, char *parms);
 static void vid_scalefilter_cvar_func2(char *cmd, char *parms);
 static void vid_screenresolution_cvar_func2(char *cmd, char *parms);
 static void vid_showfps_cvar_func2(char *cmd, char *parms);
+static void vid_showprofile_cvar_func2(char *cmd, char *parms);
 static void vid_vsync_cvar_func2(char *cmd, char *parms);
 static void vid_widescreen_cvar_func2(char *cmd, char *parms);
 static void vid_windowpos_cvar_func2(char *cmd, char *parms);
@@ -645,10 +653,14 @@ consolecmd_t consolecmds[] =
         "Shows statistics about the player."),
     CMD(print, "", null_func1, print_cmd_func2, true, PRINTCMDFORMAT,
         "Prints a player <i>message</i>."),
+    CMD(profiledump, "", profiledump_cmd_func1, profiledump_cmd_func2, true, "[<i>filename</i><b>.csv</b>]",
+        "Dumps how long was spent in each part of the last\n256 frames to a file."),
     CMD(quit, exit, null_func1, quit_cmd_func2, false, "",
         "Quits <i><b>" PACKAGE_NAME "</b></i>."),
     CVAR_BOOL(r_althud, "", bool_cvars_func1, bool_cvars_func2, BOOLVALUEALIAS,
         "Toggles an alternate heads-up display when in\nwidescreen mode."),
+    CVAR_INT(r_animupdates, "", int_cvars_func1, int_cvars_func2, CF_READONLY, NOVALUEALIAS,
+        "The number of animated texture and flat frames\nupdated in the last tic."),
     CVAR_INT(r_berserkintensity, "", int_cvars_func1, int_cvars_func2, CF_NONE, NOVALUEALIAS,
         "The intensity of the effect when the player has a\nberserk power-up and their fists equipped (<b>0</b> to <b>8</b>)."),
     CVAR_INT(r_blood, "", r_blood_cvar_func1, r_blood_cvar_func2, CF_NONE, BLOODVALUEALIAS,
@@ -681,6 +693,20 @@ consolecmd_t consolecmds[] =
         "Toggles showing a disk icon when loading and\nsaving."),
     CVAR_BOOL(r_dither, "", bool_cvars_func1, r_dither_cvar_func2, BOOLVALUEALIAS,
         "Toggles dithering of <i><b>BOOM</b></i>-compatible translucent\nwall textures."),
+    CVAR_INT(r_drawsegtests, "", int_cvars_func1, int_cvars_func2, CF_READONLY, NOVALUEALIAS,
+        "The number of drawsegs sprites were clipped against\nin the last frame."),
+    CVAR_INT(r_drawsegtests_skipped, "", int_cvars_func1, int_cvars_func2, CF_READONLY, NOVALUEALIAS,
+        "The number of drawsegs that could clip sprites but\nwere skipped in the last frame."),
+    CVAR_INT(r_dynamicresolution, "", r_dynamicresolution_cvar_func1, r_dynamicresolution_cvar_func2, CF_NONE, CAPVALUEALIAS,
+        "The framerate the width of the view is lowered to\nkeep up with when rendering is slow (<b>off</b>, or <b>1</b> to\n<b>1,000</b>)."),
+    CVAR_INT(r_dynamicresolution_budget, "", int_cvars_func1, int_cvars_func2, CF_READONLY, NOVALUEALIAS,
+        "The time in microseconds <b>r_dynamicresolution</b>\nallows for rendering each frame."),
+    CVAR_INT(r_dynamicresolution_rendertime, "", int_cvars_func1, int_cvars_func2, CF_READONLY, NOVALUEALIAS,
+        "The average time in microseconds each frame took\nto render when <b>r_dynamicresolution</b> last\nchecked."),
+    CVAR_INT(r_dynamicresolution_scale, "", int_cvars_func1, int_cvars_func2, CF_READONLY | CF_PERCENT, NOVALUEALIAS,
+        "The width of the view as a percentage of its full\nwidth, as set by <b>r_dynamicresolution</b>."),
+    CVAR_INT(r_dynamicresolution_step, "", int_cvars_func1, int_cvars_func2, CF_READONLY | CF_PERCENT, NOVALUEALIAS,
+        "How much <b>r_dynamicresolution</b> last raised or\nlowered the width of the view."),
     CVAR_BOOL(r_fixmaperrors, "", bool_cvars_func1, r_fixmaperrors_cvar_func2, BOOLVALUEALIAS,
         "Toggles the fixing of mapping errors in the official\n<i><b>DOOM</b></i> and <i><b>DOOM II</b></i> WADs."),
     CVAR_BOOL(r_fixspriteoffsets, "", bool_cvars_func1, bool_cvars_func2, BOOLVALUEALIAS,
@@ -707,12 +733,18 @@ consolecmd_t consolecmds[] =
         "Toggles lowering the player's view when in a liquid\nsector."),
     CVAR_BOOL(r_liquid_swirl, "", bool_cvars_func1, bool_cvars_func2, BOOLVALUEALIAS,
         "Toggles the swirl effect of liquid sectors."),
+    CVAR_INT(r_liquid_warps, "", int_cvars_func1, int_cvars_func2, CF_READONLY, NOVALUEALIAS,
+        "The number of liquid flats distorted by their swirl\neffect in the last frame."),
     CVAR_OTHER(r_lowpixelsize, "", null_func1, r_lowpixelsize_cvar_func2,
         "The size of pixels when the graphic detail is low\n(<i>width</i><b>\xD7</b><i>height</i>)."),
     CVAR_BOOL(r_mirroredweapons, "", bool_cvars_func1, bool_cvars_func2, BOOLVALUEALIAS,
         "Toggles randomly mirroring the weapons dropped\nby monsters."),
+    CVAR_BOOL(r_occlusion, "", bool_cvars_func1, bool_cvars_func2, BOOLVALUEALIAS,
+        "Toggles keeping track of which columns of the view\nare hidden by walls to stop rendering sooner."),
     CVAR_BOOL(r_playersprites, "", bool_cvars_func1, bool_cvars_func2, BOOLVALUEALIAS,
         "Toggles showing the player's weapon."),
+    CVAR_BOOL(r_pvs, "", bool_cvars_func1, r_pvs_cvar_func2, BOOLVALUEALIAS,
+        "Toggles working out which parts of each map might\nbe seen from where when it is loaded, to skip the\nrest when rendering and checking line of sight."),
     CVAR_BOOL(r_rockettrails, "", bool_cvars_func1, bool_cvars_func2, BOOLVALUEALIAS,
         "Toggles the trails of smoke behind rockets fired by\nthe player and cyberdemons."),
     CVAR_INT(r_screensize, "", int_cvars_func1, r_screensize_cvar_func2, CF_NONE, NOVALUEALIAS,
@@ -725,8 +757,36 @@ consolecmd_t consolecmds[] =
         "Toggles shaking the screen when the player is near\nan exploding barrel."),
     CVAR_INT(r_shake_damage, "", int_cvars_func1, int_cvars_func2, CF_PERCENT, NOVALUEALIAS,
         "The amount the screen shakes when the player is\nattacked (<b>0%</b> to <b>100%</b>)."),
+    CVAR_BOOL(r_showstats, "", bool_cvars_func1, r_showstats_cvar_func2, BOOLVALUEALIAS,
+        "Toggles showing statistics about what was rendered\nin the last frame."),
     CVAR_INT(r_skycolor, r_skycolour, r_skycolor_cvar_func1, r_skycolor_cvar_func2, CF_NONE, SKYVALUEALIAS,
         "The color of the sky (<b>none</b>, or <b>0</b> to <b>255</b>)."),
+    CVAR_INT(r_stats_drawsegs, "", int_cvars_func1, int_cvars_func2, CF_READONLY, NOVALUEALIAS,
+        "The number of drawsegs stored in the last frame."),
+    CVAR_INT(r_stats_maskedposts, "", int_cvars_func1, int_cvars_func2, CF_READONLY, NOVALUEALIAS,
+        "The number of posts of masked mid textures drawn\nin the last frame."),
+    CVAR_INT(r_stats_nodes, "", int_cvars_func1, int_cvars_func2, CF_READONLY, NOVALUEALIAS,
+        "The number of BSP nodes visited in the last frame."),
+    CVAR_INT(r_stats_pvsculled, "", int_cvars_func1, int_cvars_func2, CF_READONLY, NOVALUEALIAS,
+        "The number of BSP nodes and subsectors skipped\nbecause they can't be seen from the player's\nsector in the last frame."),
+    CVAR_INT(r_stats_segs, "", int_cvars_func1, int_cvars_func2, CF_READONLY, NOVALUEALIAS,
+        "The number of segs in the subsectors rendered in\nthe last frame."),
+    CVAR_INT(r_stats_skycolumns, "", int_cvars_func1, int_cvars_func2, CF_READONLY, NOVALUEALIAS,
+        "The number of columns of sky drawn in the last\nframe."),
+    CVAR_INT(r_stats_spanpixels, "", int_cvars_func1, int_cvars_func2, CF_READONLY, NOVALUEALIAS,
+        "The number of pixels of floors and ceilings drawn\nin the last frame."),
+    CVAR_INT(r_stats_spriteposts, "", int_cvars_func1, int_cvars_func2, CF_READONLY, NOVALUEALIAS,
+        "The number of posts of sprites, shadows and blood\nsplats drawn in the last frame."),
+    CVAR_INT(r_stats_subsectors, "", int_cvars_func1, int_cvars_func2, CF_READONLY, NOVALUEALIAS,
+        "The number of subsectors rendered in the last\nframe."),
+    CVAR_INT(r_stats_visplanes, "", int_cvars_func1, int_cvars_func2, CF_READONLY, NOVALUEALIAS,
+        "The number of visplanes used in the last frame."),
+    CVAR_INT(r_stats_visplanes_chain, "", int_cvars_func1, int_cvars_func2, CF_READONLY, NOVALUEALIAS,
+        "The length of the longest chain in the visplane\nhash table in the last frame."),
+    CVAR_INT(r_stats_vissprites, "", int_cvars_func1, int_cvars_func2, CF_READONLY, NOVALUEALIAS,
+        "The number of sprites projected in the last frame."),
+    CVAR_INT(r_stats_walldraws, "", int_cvars_func1, int_cvars_func2, CF_READONLY, NOVALUEALIAS,
+        "The number of columns of upper, middle and lower\nwall textures drawn in the last frame."),
     CVAR_BOOL(r_textures, "", bool_cvars_func1, r_textures_cvar_func2, BOOLVALUEALIAS,
         "Toggles displaying all textures."),
     CVAR_BOOL(r_translucency, "", bool_cvars_func1, r_translucency_cvar_func2, BOOLVALUEALIAS,
@@ -746,7 +806,7 @@ consolecmd_t consolecmds[] =
     CMD(resurrect, "", resurrect_cmd_func1, resurrect_cmd_func2, true, RESURRECTCMDFORMAT,
         "Resurrects the <b>player</b>, <b>all</b> monsters or a type\nof <i>monster</i>."),
     CVAR_INT(s_channels, "", int_cvars_func1, int_cvars_func2, CF_NONE, NOVALUEALIAS,
-        "The number of sound effects that can be played at\nthe same time (<b>8</b> to <b>64</b>)."),
+        "The number of sound effects that can be played at\nthe same time (<b>8</b> to <b>256</b>)."),
     CVAR_INT(s_musicvolume, "", s_volume_cvars_func1, s_volume_cvars_func2, CF_PERCENT, NOVALUEALIAS,
         "The volume level of music (<b>0%</b> to <b>100%</b>)."),
     CVAR_BOOL(s_randommusic, "", bool_cvars_func1, bool_cvars_func2, BOOLVALUEALIAS,
@@ -778,6 +838,8 @@ consolecmd_t consolecmds[] =
         "Sets a timer on each map."),
     CVAR_BOOL(tossdrop, "", bool_cvars_func1, bool_cvars_func2, BOOLVALUEALIAS,
         "Toggles tossing items dropped by monsters when\nthey die."),
+    CMD(tracebenchmark, "", game_func1, tracebenchmark_cmd_func2, false, "",
+        "Fires traces in every direction from the player,\ntiming how long their intercepts take to traverse."),
     CVAR_INT(turbo, "", turbo_cvar_func1, turbo_cvar_func2, CF_PERCENT, NOVALUEALIAS,
         "The speed of the player (<b>10%</b> to <b>400%</b>)."),
     CMD(unbind, "", null_func1, unbind_cmd_func2, true, UNBINDCMDFORMAT,
@@ -799,6 +861,8 @@ consolecmd_t consolecmds[] =
     CVAR_STR(vid_driver, "", null_func1, str_cvars_func2, CF_NONE,
         "The video driver used to render the game."),
 #endif
+    CVAR_INT(vid_frametimejitter, "", int_cvars_func1, int_cvars_func2, CF_READONLY, NOVALUEALIAS,
+        "The standard deviation of the time between the\nlast 64 frames, in microseconds."),
     CVAR_BOOL(vid_fullscreen, "", bool_cvars_func1, vid_fullscreen_cvar_func2, BOOLVALUEALIAS,
         "Toggles between fullscreen and a window."),
     CVAR_INT(vid_motionblur, "", int_cvars_func1, int_cvars_func2, CF_PERCENT, NOVALUEALIAS,
@@ -822,6 +886,8 @@ consolecmd_t consolecmds[] =
         "The screen's resolution when fullscreen (<b>desktop</b>\nor <i>width</i><b>\xD7</b><i>height</i>)."),
     CVAR_BOOL(vid_showfps, "", bool_cvars_func1, vid_showfps_cvar_func2, BOOLVALUEALIAS,
         "Toggles showing the number of frames per second."),
+    CVAR_BOOL(vid_showprofile, "", bool_cvars_func1, vid_showprofile_cvar_func2, BOOLVALUEALIAS,
+        "Toggles showing how long is spent in each part of\na frame, if the profiler is compiled in."),
     CVAR_BOOL(vid_vsync, "", bool_cvars_func1, vid_vsync_cvar_func2, BOOLVALUEALIAS,
         "Toggles vertical sync with the display's refresh\nrate."),
     CVAR_BOOL(vid_widescreen, "", bool_cvars_func1, vid_widescreen_cvar_func2, BOOLVALUEALIAS,
@@ -4289,6 +4355,68 @@ static void print_cmd_func2(char *cmd, char *parms)
         HU_SetPlayerMessage(parms, false, false);
 }
 
+//
+// profiledump CCMD
+//
+static dboolean profiledump_cmd_func1(char *cmd, char *parms)
+{
+#if defined(PROFILER)
+    return (numprofileframes > 0);
+#else
+    return false;
+#endif
+}
+
+static void profiledump_cmd_func2(char *cmd, char *parms)
+{
+#if defined(PROFILER)
+    char        filename[MAX_PATH];
+    FILE        *file;
+    const char  *appdatafolder = M_GetAppDataFolder();
+
+    M_MakeDirectory(appdatafolder);
+
+    if (!*parms)
+    {
+        int count = 0;
+
+        M_snprintf(filename, sizeof(filename), "%s" DIR_SEPARATOR_S "profiledump.csv", appdatafolder);
+
+        while (M_FileExists(filename))
+            M_snprintf(filename, sizeof(filename), "%s" DIR_SEPARATOR_S "profiledump (%i).csv", appdatafolder, ++count);
+    }
+    else
+        M_snprintf(filename, sizeof(filename), "%s" DIR_SEPARATOR_S "%s", appdatafolder, parms);
+
+    if ((file = fopen(filename, "wt")))
+    {
+        const int   frames = MIN(numprofileframes, PROFILEFRAMES);
+
+        fputs("Frame,Frame (ms)", file);
+
+        for (int i = 0; i < NUMPROFILES; i++)
+            fprintf(file, ",%s (ms)", profiles[i].name);
+
+        fputc('\n', file);
+
+        for (int frame = numprofileframes - frames; frame < numprofileframes; frame++)
+        {
+            const int   j = frame % PROFILEFRAMES;
+
+            fprintf(file, "%i,%.3f", frame, profileframetimes[j] / 1000000.0);
+
+            for (int i = 0; i < NUMPROFILES; i++)
+                fprintf(file, ",%.3f", profiles[i].history[j] / 1000000.0);
+
+            fputc('\n', file);
+        }
+
+        fclose(file);
+        C_Output("Dumped the last %s frames to <b>%s</b>.", commify(frames), filename);
+    }
+#endif
+}
+
 //
 // quit CCMD
 //
@@ -5361,6 +5489,63 @@ static void timer_cmd_func2(char *cmd, char *parms)
     }
 }
 
+//
+// tracebenchmark CCMD
+//
+#define BENCHMARKTRACES     3600
+#define BENCHMARKRANGE      8192
+
+static int      benchmarkintercepts;
+static uint64_t benchmarkchecksum;
+
+static dboolean PTR_BenchmarkTraverse(intercept_t *in)
+{
+    benchmarkintercepts++;
+    benchmarkchecksum = benchmarkchecksum * 31 + (uintptr_t)(in->isaline ? (void *)in->d.line : (void *)in->d.thing);
+
+    return true;
+}
+
+static uint64_t tracebenchmark(dboolean sort)
+{
+    const fixed_t   x = viewplayer->mo->x;
+    const fixed_t   y = viewplayer->mo->y;
+    uint64_t        start;
+
+    sortintercepts = sort;
+    benchmarkintercepts = 0;
+    benchmarkchecksum = 0;
+    start = I_GetTimeNS();
+
+    for (int i = 0; i < BENCHMARKTRACES; i++)
+    {
+        const int   angle = i * FINEANGLES / BENCHMARKTRACES;
+
+        P_PathTraverse(x, y, x + BENCHMARKRANGE * finecosine[angle], y + BENCHMARKRANGE * finesine[angle],
+            (PT_ADDLINES | PT_ADDTHINGS), PTR_BenchmarkTraverse);
+    }
+
+    return (I_GetTimeNS() - start);
+}
+
+static void tracebenchmark_cmd_func2(char *cmd, char *parms)
+{
+    const dboolean  sortintercepts_old = sortintercepts;
+    const uint64_t  sorttime = tracebenchmark(true);
+    const uint64_t  sortchecksum = benchmarkchecksum;
+    const uint64_t  scantime = tracebenchmark(false);
+
+    sortintercepts = sortintercepts_old;
+
+    C_Output("%s traces were fired from the player, passing through %s intercepts.",
+        commify(BENCHMARKTRACES), commify(benchmarkintercepts));
+    C_Output("Sorting the intercepts took %.2fms, and scanning them took %.2fms.",
+        sorttime / 1000000.0, scantime / 1000000.0);
+
+    if (benchmarkchecksum != sortchecksum)
+        C_Warning(0, "The intercepts weren't traversed in the same order!");
+}
+
 //
 // unbind CCMD
 //
@@ -6300,6 +6485,30 @@ static void r_dither_cvar_func2(char *cmd, char *parms)
     }
 }
 
+//
+// r_dynamicresolution CVAR
+//
+static dboolean r_dynamicresolution_cvar_func1(char *cmd, char *parms)
+{
+    return (C_LookupValueFromAlias(parms, CAPVALUEALIAS) != INT_MIN || int_cvars_func1(cmd, parms));
+}
+
+static void r_dynamicresolution_cvar_func2(char *cmd, char *parms)
+{
+    const int   value = C_LookupValueFromAlias(parms, CAPVALUEALIAS);
+
+    if (value != INT_MIN)
+    {
+        if (value != r_dynamicresolution)
+        {
+            r_dynamicresolution = value;
+            M_SaveCVARs();
+        }
+    }
+    else
+        int_cvars_func2(cmd, parms);
+}
+
 //
 // r_fixmaperrors CVAR
 //
@@ -6465,6 +6674,19 @@ static void r_lowpixelsize_cvar_func2(char *cmd, char *parms)
     }
 }
 
+//
+// r_pvs CVAR
+//
+static void r_pvs_cvar_func2(char *cmd, char *parms)
+{
+    const dboolean  r_pvs_old = r_pvs;
+
+    bool_cvars_func2(cmd, parms);
+
+    if (r_pvs && !r_pvs_old && gamestate == GS_LEVEL && !pvsrows)
+        P_BuildPVS();
+}
+
 //
 // r_screensize CVAR
 //
@@ -6541,6 +6763,19 @@ static void r_shadows_translucency_cvar_func2(char *cmd, char *parms)
     }
 }
 
+//
+// r_showstats CVAR
+//
+static void r_showstats_cvar_func2(char *cmd, char *parms)
+{
+    const dboolean  r_showstats_old = r_showstats;
+
+    bool_cvars_func2(cmd, parms);
+
+    if (r_showstats != r_showstats_old)
+        I_UpdateBlitFunc(viewplayer->damagecount);
+}
+
 //
 // r_skycolor CVAR
 //
@@ -7041,6 +7276,19 @@ static void vid_showfps_cvar_func2(char *cmd, char *parms)
     }
 }
 
+//
+// vid_showprofile CVAR
+//
+static void vid_showprofile_cvar_func2(char *cmd, char *parms)
+{
+    const dboolean  vid_showprofile_old = vid_showprofile;
+
+    bool_cvars_func2(cmd, parms);
+
+    if (vid_showprofile != vid_showprofile_old)
+        I_UpdateBlitFunc(viewplayer->damagecount);
+}
+
 //
 // vid_vsync CVAR
 //
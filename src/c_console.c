@@ -126,6 +126,8 @@ static int              timestampx;
 static int              zerowidth;
 static int              warningwidth;
 
+static byte             *blurscreen;
+
 static int              consolecaretcolor = 4;
 static int              consolelowfpscolor = 180;
 static int              consolehighfpscolor = 116;
@@ -605,6 +607,8 @@ static void C_DrawScrollbar(void)
 
 void C_Init(void)
 {
+    blurscreen = malloc(SCREENWIDTH * SCREENHEIGHT);
+
     for (int i = 0, j = CONSOLEFONTSTART; i < CONSOLEFONTSIZE; i++)
     {
         char    buffer[9];
@@ -721,45 +725,13 @@ void C_HideConsoleFast(void)
 static void C_DrawBackground(int height)
 {
     static dboolean blurred;
-    static byte     blurscreen[SCREENWIDTH * SCREENHEIGHT];
 
     height = (height + 5) * CONSOLEWIDTH;
 
     if (!blurred)
     {
         memcpy(blurscreen, screens[0], height);
-
-        for (int y = 0; y <= height - CONSOLEWIDTH; y += CONSOLEWIDTH)
-            for (int x = y; x <= y + CONSOLEWIDTH - 2; x++)
-                blurscreen[x] = tinttab50[blurscreen[x] + (blurscreen[x + 1] << 8)];
-
-        for (int y = 0; y <= height - CONSOLEWIDTH; y += CONSOLEWIDTH)
-            for (int x = y + CONSOLEWIDTH - 2; x >= y; x--)
-                blurscreen[x] = tinttab50[blurscreen[x] + (blurscreen[x - 1] << 8)];
-
-        for (int y = 0; y <= height - CONSOLEWIDTH * 2; y += CONSOLEWIDTH)
-            for (int x = y; x <= y + CONSOLEWIDTH - 2; x++)
-                blurscreen[x] = tinttab50[blurscreen[x] + (blurscreen[x + CONSOLEWIDTH + 1] << 8)];
-
-        for (int y = height - CONSOLEWIDTH; y >= CONSOLEWIDTH; y -= CONSOLEWIDTH)
-            for (int x = y + CONSOLEWIDTH - 1; x >= y + 1; x--)
-                blurscreen[x] = tinttab50[blurscreen[x] + (blurscreen[x - CONSOLEWIDTH - 1] << 8)];
-
-        for (int y = 0; y <= height - CONSOLEWIDTH * 2; y += CONSOLEWIDTH)
-            for (int x = y; x <= y + CONSOLEWIDTH - 1; x++)
-                blurscreen[x] = tinttab50[blurscreen[x] + (blurscreen[x + CONSOLEWIDTH] << 8)];
-
-        for (int y = height - CONSOLEWIDTH; y >= CONSOLEWIDTH; y -= CONSOLEWIDTH)
-            for (int x = y; x <= y + CONSOLEWIDTH - 1; x++)
-                blurscreen[x] = tinttab50[blurscreen[x] + (blurscreen[x - CONSOLEWIDTH] << 8)];
-
-        for (int y = 0; y <= height - CONSOLEWIDTH * 2; y += CONSOLEWIDTH)
-            for (int x = y + CONSOLEWIDTH - 1; x >= y + 1; x--)
-                blurscreen[x] = tinttab50[blurscreen[x] + (blurscreen[x + CONSOLEWIDTH - 1] << 8)];
-
-        for (int y = height - CONSOLEWIDTH; y >= CONSOLEWIDTH; y -= CONSOLEWIDTH)
-            for (int x = y; x <= y + CONSOLEWIDTH - 2; x++)
-                blurscreen[x] = tinttab50[blurscreen[x] + (blurscreen[x - CONSOLEWIDTH + 1] << 8)];
+        V_BlurScreen(blurscreen, CONSOLEWIDTH, height / CONSOLEWIDTH);
     }
 
     if (forceconsoleblurredraw)
@@ -1057,6 +1029,76 @@ void C_UpdateFPS(void)
     }
 }
 
+#if defined(PROFILER)
+static void C_DrawProfileLine(int x, int y, const char *name, const uint64_t time)
+{
+    char    buffer[16];
+
+    M_snprintf(buffer, sizeof(buffer), "%.2fms", time / 1000000.0);
+    C_DrawOverlayText(x, y, name, consolehighfpscolor);
+    C_DrawOverlayText(CONSOLEWIDTH - C_TextWidth(buffer, false, false) - CONSOLETEXTX + 1, y, buffer, consolehighfpscolor);
+}
+#endif
+
+void C_UpdateProfile(void)
+{
+#if defined(PROFILER)
+    if (numprofileframes > 1 && !dowipe && !paused && !menuactive)
+    {
+        const int   frames = MIN(numprofileframes, PROFILEFRAMES);
+        const int   x = CONSOLEWIDTH - C_TextWidth("R_RenderPlayerView 000.00ms", false, false) - CONSOLETEXTX * 2;
+        int         y = CONSOLETEXTY + CONSOLELINEHEIGHT;
+        uint64_t    frametime = 0;
+
+        for (int i = 0; i < frames; i++)
+            frametime += profileframetimes[i];
+
+        C_DrawProfileLine(x, y, "Frame", frametime / frames);
+
+        for (int i = 0; i < NUMPROFILES; i++)
+            C_DrawProfileLine(x + profiles[i].depth * CONSOLETEXTX, (y += CONSOLELINEHEIGHT), profiles[i].name,
+                profiles[i].total / frames);
+    }
+#endif
+}
+
+void C_UpdateRenderStats(void)
+{
+    if (gamestate == GS_LEVEL && !dowipe && !paused && !menuactive)
+    {
+        const struct
+        {
+            const char  *name;
+            const int   value;
+        } stats[] = {
+            { "Nodes",                  r_stats_nodes           },
+            { "Culled by PVS",          r_stats_pvsculled       },
+            { "Subsectors",             r_stats_subsectors      },
+            { "Segs",                   r_stats_segs            },
+            { "Drawsegs",               r_stats_drawsegs        },
+            { "Visplanes",              r_stats_visplanes       },
+            { "Longest visplane chain", r_stats_visplanes_chain },
+            { "Vissprites",             r_stats_vissprites      },
+            { "Wall draws",             r_stats_walldraws       },
+            { "Sky columns",            r_stats_skycolumns      },
+            { "Masked posts",           r_stats_maskedposts     },
+            { "Sprite posts",           r_stats_spriteposts     },
+            { "Span pixels",            r_stats_spanpixels      }
+        };
+        const int   x = CONSOLETEXTX + C_TextWidth("Longest visplane chain 000,000", false, false);
+        int         y = CONSOLETEXTY + CONSOLELINEHEIGHT;
+
+        for (int i = 0; i < arrlen(stats); i++, y += CONSOLELINEHEIGHT)
+        {
+            char    *value = commify(stats[i].value);
+
+            C_DrawOverlayText(CONSOLETEXTX, y, stats[i].name, consolehighfpscolor);
+            C_DrawOverlayText(x - C_TextWidth(value, false, false), y, value, consolehighfpscolor);
+            free(value);
+        }
+    }
+}
+
 void C_Drawer(void)
 {
     if (consoleheight)
@@ -190,6 +190,8 @@ dboolean C_Responder(event_t *ev);
 void C_PrintCompileDate(void);
 void C_PrintSDLVersions(void);
 void C_UpdateFPS(void);
+void C_UpdateProfile(void);
+void C_UpdateRenderStats(void);
 char *C_GetTimeStamp(unsigned int tics);
 
 #endif
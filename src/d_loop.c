@@ -77,7 +77,10 @@ void TryRunTics(void)
         if (menuactive)
             M_Ticker();
 
+        PROFILE_START(PROFILE_G_TICKER);
         G_Ticker();
+        PROFILE_END(PROFILE_G_TICKER);
+
         gametime++;
 
         if (localcmds[0].buttons & BT_SPECIAL)
@@ -158,10 +158,6 @@ struct tm           gamestarttime;
 
 extern evtype_t     lasteventtype;
 
-#if defined(_WIN32)
-extern HANDLE       CapFPSEvent;
-#endif
-
 //
 // D_PostEvent
 //
@@ -259,15 +255,23 @@ void D_Display(void)
         HU_Erase();
 
         // draw the view directly
+        PROFILE_START(PROFILE_R_RENDERPLAYERVIEW);
         R_RenderPlayerView();
+        PROFILE_END(PROFILE_R_RENDERPLAYERVIEW);
 
         if (am_path && !(viewplayer->cheats & CF_NOCLIP) && !freeze)
             AM_AddToPath();
 
         if (mapwindow || automapactive)
+        {
+            PROFILE_START(PROFILE_AM_DRAWER);
             AM_Drawer();
+            PROFILE_END(PROFILE_AM_DRAWER);
+        }
 
+        PROFILE_START(PROFILE_ST_DRAWER);
         ST_Drawer((viewheight == SCREENHEIGHT), true);
+        PROFILE_END(PROFILE_ST_DRAWER);
 
         // see if the border needs to be initially drawn
         if (oldgamestate != GS_LEVEL)
@@ -281,7 +285,7 @@ void D_Display(void)
         {
             if (scaledviewwidth != SCREENWIDTH)
             {
-                if (menuactive || menuactivestate || !viewactivestate || vid_showfps || paused
+                if (menuactive || menuactivestate || !viewactivestate || vid_showfps || vid_showprofile || r_showstats || paused
                     || pausedstate || message_on || consoleheight > CONSOLETOP)
                     borderdrawcount = 3;
 
@@ -291,12 +295,11 @@ void D_Display(void)
                     borderdrawcount--;
                 }
             }
-
-            if (r_detail == r_detail_low)
-                V_LowGraphicDetail();
         }
 
+        PROFILE_START(PROFILE_HU_DRAWER);
         HU_Drawer();
+        PROFILE_END(PROFILE_HU_DRAWER);
     }
 
     menuactivestate = menuactive;
@@ -345,15 +348,6 @@ void D_Display(void)
         blitfunc();             // blit buffer
         mapblitfunc();
 
-#if defined(_WIN32)
-        if (CapFPSEvent)
-            WaitForSingleObject(CapFPSEvent, 1000);
-#endif
-
-        // Figure out how far into the current tic we're in as a fixed_t
-        if (vid_capfps != TICRATE)
-            fractionaltic = I_GetTimeMS() * TICRATE % 1000 * FRACUNIT / 1000;
-
         return;
     }
 
@@ -376,11 +370,6 @@ void D_Display(void)
         M_Drawer();
         blitfunc();             // blit buffer
         mapblitfunc();
-
-#if defined(_WIN32)
-        if (CapFPSEvent)
-            WaitForSingleObject(CapFPSEvent, 1000);
-#endif
     } while (!done);
 }
 
@@ -407,10 +396,20 @@ static void D_DoomLoop(void)
     {
         TryRunTics();       // will run at least one tic
 
+        PROFILE_START(PROFILE_S_UPDATESOUNDS);
         S_UpdateSounds();   // move positional sounds
+        PROFILE_END(PROFILE_S_UPDATESOUNDS);
 
         // Update display, next frame, with current state.
         D_Display();
+
+        PROFILE_FRAME();
+
+        I_WaitForFrame();   // hold the framerate to vid_capfps
+
+        // Figure out how far into the current tic we're in as a fixed_t
+        if (vid_capfps != TICRATE)
+            fractionaltic = I_GetTimeMS() * TICRATE % 1000 * FRACUNIT / 1000;
     }
 }
 
@@ -1785,6 +1784,13 @@ static void D_DoomMainSetup(void)
     else if ((fastparm = M_CheckParm("-fastmonsters")))
         C_Output("A <b>-fastmonsters</b> parameter was found on the command-line. Monsters will be faster.");
 
+    if (M_CheckParm("-scanintercepts"))
+    {
+        sortintercepts = false;
+        C_Output("A <b>-scanintercepts</b> parameter was found on the command-line. Intercepts will be traversed by scanning for "
+            "the nearest one each step.");
+    }
+
     if ((devparm = M_CheckParm("-devparm")))
         C_Output("A <b>-devparm</b> parameter was found on the command-line. %s", s_D_DEVSTR);
 
@@ -1817,6 +1823,21 @@ static void D_DoomMainSetup(void)
     else
         G_SetMovementSpeed(turbo);
 
+    // must be set before anything sized from SCREENWIDTH or SCREENHEIGHT is initialized
+    if ((p = M_CheckParmWithArgs("-screenscale", 1, 1)))
+    {
+        const int   scale = atoi(myargv[p + 1]);
+
+        if (scale >= 1 && scale <= MAXSCREENSCALE)
+        {
+            screenscale = scale;
+            C_Output("A <b>-screenscale</b> parameter was found on the command-line. Each frame will be rendered at %ix%i.",
+                SCREENWIDTH, SCREENHEIGHT);
+        }
+        else
+            C_Warning(1, "The <b>-screenscale</b> parameter on the command-line must be <b>1</b> or <b>2</b>.");
+    }
+
     // init subsystems
     V_Init();
     I_InitTimer();
@@ -2259,15 +2280,7 @@ static void D_DoomMainSetup(void)
             C_Output("Warping to %s...", lumpname);
             G_DeferredInitNew(startskill, startepisode, startmap);
         }
-#if SCREENSCALE == 1
-        else
-        {
-            menuactive = false;
-            splashscreen = false;
-            D_StartTitle(1);
-        }
-#else
-        else if (M_CheckParm("-nosplash"))
+        else if (SCREENSCALE != DEFAULTSCREENSCALE || M_CheckParm("-nosplash"))
         {
             menuactive = false;
             splashscreen = false;
@@ -2275,7 +2288,6 @@ static void D_DoomMainSetup(void)
         }
         else
             D_StartTitle(0);
-#endif
     }
 
     time = striptrailingzero((I_GetTimeMS() - startuptimer) / 1000.0f, 1);
@@ -115,7 +115,17 @@ typedef enum
 
 #define ORIGINALSBARHEIGHT  32
 
-#define SCREENSCALE         2
+// The screen scale is chosen at startup using the -screenscale
+//  command-line parameter. Buffers are allocated for it when initialized.
+//  Only 1x and 2x are allowed, since the console and HUD fonts, status bar
+//  and splash screen are drawn at native resolution for 2x, with 1x paths
+//  that scale them down, but none that scale them up.
+#define DEFAULTSCREENSCALE  2
+#define MAXSCREENSCALE      2
+
+extern int screenscale;
+
+#define SCREENSCALE         screenscale
 
 #define SCREENWIDTH         (ORIGINALWIDTH * SCREENSCALE)
 #define SCREENHEIGHT        (ORIGINALHEIGHT * SCREENSCALE)
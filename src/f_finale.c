@@ -302,52 +302,44 @@ static void F_TextWrite(void)
     src = (byte *)W_CacheLumpName((char *)finaleflat);
     dest = screens[0];
 
-#if SCREENSCALE == 1
-    for (int y = 0; y < SCREENHEIGHT; y++)
+    if (SCREENSCALE != DEFAULTSCREENSCALE)
     {
-        for (int x = 0; x < SCREENWIDTH / 64; x++)
-        {
-            memcpy(dest, src + ((y & 63) << 6), 64);
-            dest += 64;
-        }
-
-        if (SCREENWIDTH & 63)
-        {
-            memcpy(dest, src + ((y & 63) << 6), SCREENWIDTH & 63);
-            dest += (SCREENWIDTH & 63);
-        }
+        for (int y = 0; y < SCREENHEIGHT; y++)
+            for (int x = 0; x < SCREENWIDTH; x++)
+                *dest++ = src[(((y / SCREENSCALE) & 63) << 6) + ((x / SCREENSCALE) & 63)];
     }
-#else
-    for (int y = 0; y < SCREENHEIGHT; y += 2)
-        for (int x = 0; x < SCREENWIDTH / 32; x += 2)
-        {
-            for (int i = 0; i < 64; i++)
+    else
+    {
+        for (int y = 0; y < SCREENHEIGHT; y += 2)
+            for (int x = 0; x < SCREENWIDTH / 32; x += 2)
             {
-                int     j = i * 2;
-                byte    dot = src[(((y / 2) & 63) << 6) + i];
+                for (int i = 0; i < 64; i++)
+                {
+                    int     j = i * 2;
+                    byte    dot = src[(((y / 2) & 63) << 6) + i];
 
-                if (y * SCREENWIDTH + x + j < SCREENWIDTH * (SCREENHEIGHT - 1))
-                    *(dest + j) = dot;
+                    if (y * SCREENWIDTH + x + j < SCREENWIDTH * (SCREENHEIGHT - 1))
+                        *(dest + j) = dot;
 
-                j++;
+                    j++;
 
-                if (y * SCREENWIDTH + x + j < SCREENWIDTH * (SCREENHEIGHT - 1))
-                    *(dest + j) = dot;
+                    if (y * SCREENWIDTH + x + j < SCREENWIDTH * (SCREENHEIGHT - 1))
+                        *(dest + j) = dot;
 
-                j += SCREENWIDTH;
+                    j += SCREENWIDTH;
 
-                if (y * SCREENWIDTH + x + j < SCREENWIDTH * (SCREENHEIGHT - 1))
-                    *(dest + j) = dot;
+                    if (y * SCREENWIDTH + x + j < SCREENWIDTH * (SCREENHEIGHT - 1))
+                        *(dest + j) = dot;
 
-                j--;
+                    j--;
 
-                if (y * SCREENWIDTH + x + j < SCREENWIDTH * (SCREENHEIGHT - 1))
-                    *(dest + j) = dot;
-            }
+                    if (y * SCREENWIDTH + x + j < SCREENWIDTH * (SCREENHEIGHT - 1))
+                        *(dest + j) = dot;
+                }
 
-            dest += 128;
-        }
-#endif
+                dest += 128;
+            }
+    }
 
     for (; count; count--)
     {
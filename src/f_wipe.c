@@ -52,17 +52,6 @@ static byte *wipe_scr_start;
 static byte *wipe_scr_end;
 static byte *wipe_scr;
 
-static void wipe_shittyColMajorXform(short *array)
-{
-    short   dest[SCREENWIDTH * SCREENHEIGHT];
-
-    for (int y = 0; y < SCREENHEIGHT; y++)
-        for (int x = 0; x < SCREENWIDTH / 2; x++)
-            dest[y + x * SCREENHEIGHT] = array[y * SCREENWIDTH / 2 + x];
-
-    memcpy(array, dest, SCREENWIDTH * SCREENHEIGHT);
-}
-
 static int  *ypos;
 static int  speed;
 
@@ -73,11 +62,6 @@ static void wipe_initMelt(void)
     // copy start screen to main screen
     memcpy(wipe_scr, wipe_scr_start, SCREENWIDTH * SCREENHEIGHT);
 
-    // makes this wipe faster (in theory)
-    // to have stuff in column-major format
-    wipe_shittyColMajorXform((short *)wipe_scr_start);
-    wipe_shittyColMajorXform((short *)wipe_scr_end);
-
     // setup initial column positions
     // (ypos < 0 => not ready to scroll yet)
     ypos = malloc(SCREENWIDTH * sizeof(int));
@@ -87,43 +71,43 @@ static void wipe_initMelt(void)
         ypos[i] = ypos[i + 1] = BETWEEN(-15, ypos[i - 1] + (M_Random() % 3) - 1, 0);
 }
 
+//
+// Rather than transposing the start and end screens so each column can be
+//  moved down in turn, only the position of each column is advanced every tic.
+//  The screen is then drawn a row at a time, with each pair of pixels coming
+//  from either the end screen or the start screen moved down by its column.
+//
 static dboolean wipe_doMelt(int tics)
 {
     dboolean    done = true;
+    const short *start = (short *)wipe_scr_start;
+    const short *end = (short *)wipe_scr_end;
+    short       *dest = (short *)wipe_scr;
+    const int   width = SCREENWIDTH / 2;
 
     while (tics--)
-        for (int i = 0; i < SCREENWIDTH / 2; i++)
+        for (int i = 0; i < width; i++)
         {
             if (ypos[i] < 0)
             {
                 ypos[i]++;
                 done = false;
-                continue;
             }
-
-            if (ypos[i] < SCREENHEIGHT)
+            else if (ypos[i] < SCREENHEIGHT)
             {
-                int     dy = (ypos[i] < 16 ? ypos[i] + 1 : speed);
-                short   *s = &((short *)wipe_scr_end)[i * SCREENHEIGHT + ypos[i]];
-                short   *d = &((short *)wipe_scr)[ypos[i] * SCREENWIDTH / 2 + i];
-
-                if (ypos[i] + dy >= SCREENHEIGHT)
-                    dy = SCREENHEIGHT - ypos[i];
-
-                for (int idx = 0, j = dy; j; j--, idx += SCREENWIDTH / 2)
-                    d[idx] = *s++;
-
-                ypos[i] += dy;
-                s = &((short *)wipe_scr_start)[i * SCREENHEIGHT];
-                d = &((short *)wipe_scr)[ypos[i] * SCREENWIDTH / 2 + i];
-
-                for (int idx = 0, j = SCREENHEIGHT - ypos[i]; j; j--, idx += SCREENWIDTH / 2)
-                    d[idx] = *s++;
-
+                ypos[i] = MIN(ypos[i] + (ypos[i] < 16 ? ypos[i] + 1 : speed), SCREENHEIGHT);
                 done = false;
             }
         }
 
+    for (int y = 0; y < SCREENHEIGHT; y++, dest += width, end += width)
+        for (int i = 0; i < width; i++)
+        {
+            const int   offset = MAX(0, ypos[i]);
+
+            dest[i] = (y < offset ? end[i] : start[(y - offset) * width + i]);
+        }
+
     return done;
 }
 
@@ -433,7 +433,7 @@ void HUlib_EraseTextLine(hu_textline_t *l)
             else
             {
                 R_VideoErase(yoffset, viewwindowx);                             // erase left border
-                R_VideoErase(yoffset + viewwindowx + viewwidth, viewwindowx);   // erase right border
+                R_VideoErase(yoffset + viewwindowx + scaledviewwidth, viewwindowx);   // erase right border
             }
     }
 
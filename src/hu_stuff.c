@@ -88,7 +88,7 @@ static int              message_counter;
 
 static dboolean         headsupactive;
 
-byte                    tempscreen[SCREENWIDTH * SCREENHEIGHT];
+byte                    *tempscreen;
 
 static patch_t          *minuspatch;
 static short            minuspatchwidth;
@@ -211,6 +211,8 @@ void HU_Init(void)
 {
     int lump;
 
+    tempscreen = malloc(SCREENWIDTH * SCREENHEIGHT);
+
     // load the heads-up font
     for (int i = 0, j = HU_FONTSTART; i < HU_FONTSIZE; i++)
     {
@@ -39,6 +39,7 @@
 #include <string.h>
 
 #include "SDL_mixer.h"
+#include "SDL_thread.h"
 
 #include "c_console.h"
 #include "i_midirpc.h"
@@ -54,6 +55,32 @@ static dboolean music_initialized;
 static int      current_music_volume;
 static int      paused_midi_volume;
 
+// MUS lumps converted to MIDI, cached by a hash of the lump so revisiting a map doesn't convert its
+// music again. The most recently used songs are kept first, and only MAXCACHEDSONGS are kept. The
+// mutex also serializes calls to mmus2mid(), which isn't reentrant.
+#define MAXCACHEDSONGS  8
+
+typedef struct cachedsong_s
+{
+    uint32_t            hash;
+    int                 size;
+    uint8_t             *mus;
+    uint8_t             *mid;
+    int                 midlen;
+    struct cachedsong_s *next;
+} cachedsong_t;
+
+static cachedsong_t *songcache;
+static cachedsong_t *currentsong;
+static SDL_mutex    *songcachemutex;
+
+// A MUS lump being converted in the background by I_PrecacheSong()
+static SDL_Thread   *precachethread;
+static SDL_atomic_t precachebusy;
+static uint32_t     precachehash;
+static uint8_t      *precachedata;
+static int          precachesize;
+
 #if defined(_WIN32)
 static dboolean midirpc;
 dboolean        serverMidiPlaying;
@@ -65,12 +92,30 @@ void I_ShutdownMusic(void)
     if (!music_initialized)
         return;
 
+    if (precachethread)
+    {
+        SDL_WaitThread(precachethread, NULL);
+        precachethread = NULL;
+    }
+
     Mix_FadeOutMusic(500);
     music_initialized = false;
 
     Mix_CloseAudio();
     SDL_QuitSubSystem(SDL_INIT_AUDIO);
 
+    while (songcache)
+    {
+        cachedsong_t    *next = songcache->next;
+
+        free(songcache->mus);
+        free(songcache->mid);
+        free(songcache);
+        songcache = next;
+    }
+
+    currentsong = NULL;
+
 #if defined(_WIN32)
     I_MidiRPCClientShutDown();
 #endif
@@ -104,6 +149,9 @@ dboolean I_InitMusic(void)
 
     SDL_PauseAudio(0);
 
+    if (!songcachemutex)
+        songcachemutex = SDL_CreateMutex();
+
     music_initialized = true;
 
 #if defined(_WIN32)
@@ -237,6 +285,144 @@ void I_UnRegisterSong(void *handle)
         Mix_FreeMusic(handle);
 }
 
+// FNV-1a hash of a music lump
+static uint32_t SongHash(const uint8_t *data, int size)
+{
+    uint32_t    hash = 2166136261u;
+
+    for (int i = 0; i < size; i++)
+        hash = (hash ^ data[i]) * 16777619u;
+
+    return hash;
+}
+
+// Free the least recently used song in the cache, other than the one being played.
+static void FreeOldestCachedSong(void)
+{
+    cachedsong_t    **link = NULL;
+
+    for (cachedsong_t **song = &songcache; *song; song = &(*song)->next)
+        if (*song != currentsong)
+            link = song;
+
+    if (link)
+    {
+        cachedsong_t    *oldest = *link;
+
+        *link = oldest->next;
+        free(oldest->mus);
+        free(oldest->mid);
+        free(oldest);
+    }
+}
+
+// Find the converted MIDI data of a MUS lump in the cache, converting it if it isn't there. The
+// song found becomes the current song if it is about to be played.
+static cachedsong_t *GetCachedSong(uint8_t *data, int size, uint32_t hash, dboolean play)
+{
+    cachedsong_t    **link;
+    cachedsong_t    *song;
+    int             count = 0;
+
+    SDL_LockMutex(songcachemutex);
+
+    for (link = &songcache; (song = *link); link = &song->next, count++)
+        if (song->hash == hash && song->size == size && !memcmp(song->mus, data, size))
+            break;
+
+    if (song)
+    {
+        // move it to the front of the cache
+        *link = song->next;
+        song->next = songcache;
+        songcache = song;
+    }
+    else
+    {
+        MIDI    mididata;
+
+        memset(&mididata, 0, sizeof(MIDI));
+
+        if (mmus2mid(data, (size_t)size, &mididata) && (song = malloc(sizeof(*song))))
+        {
+            if (!(song->mus = malloc(size)))
+            {
+                free(song);
+                song = NULL;
+            }
+            else
+            {
+                if (count >= MAXCACHEDSONGS)
+                    FreeOldestCachedSong();
+
+                // Hurrah! Let's make it a mid
+                MIDIToMidi(&mididata, &song->mid, &song->midlen);
+                memcpy(song->mus, data, size);
+
+                song->hash = hash;
+                song->size = size;
+                song->next = songcache;
+                songcache = song;
+            }
+        }
+
+        FreeMIDIData(&mididata);
+    }
+
+    if (play)
+        currentsong = song;
+
+    SDL_UnlockMutex(songcachemutex);
+
+    return song;
+}
+
+static int PrecacheSongThread(void *data)
+{
+    GetCachedSong(precachedata, precachesize, precachehash, false);
+    free(precachedata);
+    SDL_AtomicSet(&precachebusy, false);
+
+    return 0;
+}
+
+// Start converting a MUS lump to MIDI in the background, so it is ready by the time it is
+// registered by I_RegisterSong().
+void I_PrecacheSong(void *data, int size)
+{
+    uint32_t    hash;
+
+    if (!music_initialized || size < 14 || !mmuscheckformat((uint8_t *)data, size))
+        return;
+
+    if (precachethread)
+    {
+        // only one song is converted at a time
+        if (SDL_AtomicGet(&precachebusy))
+            return;
+
+        SDL_WaitThread(precachethread, NULL);
+        precachethread = NULL;
+    }
+
+    hash = SongHash(data, size);
+
+    // the lump may be freed from the cache before the thread is done with it, so copy it
+    if (!(precachedata = malloc(size)))
+        return;
+
+    memcpy(precachedata, data, size);
+    precachesize = size;
+    precachehash = hash;
+    SDL_AtomicSet(&precachebusy, true);
+
+    if (!(precachethread = SDL_CreateThread(PrecacheSongThread, "PrecacheSong", NULL)))
+    {
+        free(precachedata);
+        SDL_AtomicSet(&precachebusy, false);
+    }
+}
+
 void *I_RegisterSong(void *data, int size)
 {
     if (!music_initialized)
@@ -256,24 +442,24 @@ void *I_RegisterSong(void *data, int size)
                 midimusictype = true;
             else if (mmuscheckformat((uint8_t *)data, size))    // is it a MUS?
             {
-                MIDI    mididata;
-                uint8_t *mid;
-                int     midlen;
+                const uint32_t  hash = SongHash(data, size);
+                cachedsong_t    *song;
 
                 musmusictype = true;
 
-                memset(&mididata, 0, sizeof(MIDI));
+                // wait for the song if it's still being converted in the background
+                if (precachethread && precachehash == hash)
+                {
+                    SDL_WaitThread(precachethread, NULL);
+                    precachethread = NULL;
+                }
 
-                if (!mmus2mid((uint8_t *)data, (size_t)size, &mididata))
+                if (!(song = GetCachedSong((uint8_t *)data, size, hash, true)))
                     return NULL;
 
-                // Hurrah! Let's make it a mid and give it to SDL_mixer
-                MIDIToMidi(&mididata, &mid, &midlen);
-
-                FreeMIDIData(&mididata);
-
-                data = mid;
-                size = midlen;
+                // give the mid to SDL_mixer
+                data = song->mid;
+                size = song->midlen;
                 midimusictype = true;                           // now it's a MIDI
             }
         }
@@ -36,6 +36,11 @@
 ========================================================================
 */
 
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SOFTMIXER_SSE2
+#endif
+
 #include "SDL_mixer.h"
 
 #include "c_console.h"
@@ -57,12 +62,37 @@ struct allocated_sound_s
     allocated_sound_t       *next;
 };
 
+// A channel mixed by the built-in software mixer
+typedef struct
+{
+    int16_t                 *data;
+    int                     length;
+    int                     position;
+    int                     leftvol;
+    int                     rightvol;
+} mixchannel_t;
+
+// A pending volume/separation change, applied to all channels at once by I_ApplySoundParams()
+typedef struct
+{
+    int                     channel;
+    int                     vol;
+    int                     sep;
+} soundparams_t;
+
 static dboolean             sound_initialized;
 
 static allocated_sound_t    *channels_playing[s_channels_max];
 
 static int                  mixer_freq;
 
+dboolean                    softmixer;
+
+static mixchannel_t         mixchannels[s_channels_max];
+
+static soundparams_t        pendingparams[s_channels_max];
+static int                  numpendingparams;
+
 // Doubly-linked list of allocated sounds.
 // When a sound is played, it is moved to the head, so that the oldest sounds not used recently are at the tail.
 static allocated_sound_t    *allocated_sounds_head;
@@ -226,7 +256,14 @@ static void ReleaseSoundOnChannel(int channel)
     if (!snd)
         return;
 
-    Mix_HaltChannel(channel);
+    if (softmixer)
+    {
+        SDL_LockAudio();
+        mixchannels[channel].data = NULL;
+        SDL_UnlockAudio();
+    }
+    else
+        Mix_HaltChannel(channel);
 
     channels_playing[channel] = NULL;
     UnlockAllocatedSound(snd);
@@ -294,9 +331,102 @@ dboolean CacheSFX(sfxinfo_t *sfxinfo)
     return ExpandSoundData(sfxinfo, data + 24, ((data[3] << 8) | data[2]), length - 32);
 }
 
+// Mix every playing channel into SDL_mixer's output stream. This is registered as SDL_mixer's
+// post-mix callback, so it is called on the audio thread with the audio device already locked.
+static void I_SoftMixer(void *udata, Uint8 *stream, int len)
+{
+    int16_t *output = (int16_t *)stream;
+    int     frames = len / 4;
+
+    for (int i = 0; i < s_channels_max; i++)
+    {
+        mixchannel_t    *channel = &mixchannels[i];
+        int16_t         *input;
+        int             count;
+        int             j = 0;
+
+        if (!channel->data)
+            continue;
+
+        input = channel->data + channel->position * 2;
+        count = MIN(frames, channel->length - channel->position);
+
+#if defined(SOFTMIXER_SSE2)
+        {
+            const __m128i   volume = _mm_set_epi16(channel->rightvol, channel->leftvol, channel->rightvol, channel->leftvol,
+                                channel->rightvol, channel->leftvol, channel->rightvol, channel->leftvol);
+
+            // 4 stereo frames (8 samples) at a time
+            for (; j + 4 <= count; j += 4)
+            {
+                __m128i samples = _mm_loadu_si128((__m128i *)&input[j * 2]);
+                __m128i lo = _mm_mullo_epi16(samples, volume);
+                __m128i hi = _mm_mulhi_epi16(samples, volume);
+                __m128i mixed = _mm_packs_epi32(_mm_srai_epi32(_mm_unpacklo_epi16(lo, hi), 8),
+                            _mm_srai_epi32(_mm_unpackhi_epi16(lo, hi), 8));
+
+                _mm_storeu_si128((__m128i *)&output[j * 2],
+                    _mm_adds_epi16(_mm_loadu_si128((__m128i *)&output[j * 2]), mixed));
+            }
+        }
+#endif
+
+        for (; j < count; j++)
+        {
+            output[j * 2] = (int16_t)BETWEEN(SHRT_MIN, output[j * 2] + ((input[j * 2] * channel->leftvol) >> 8), SHRT_MAX);
+            output[j * 2 + 1] = (int16_t)BETWEEN(SHRT_MIN, output[j * 2 + 1] + ((input[j * 2 + 1] * channel->rightvol) >> 8),
+                SHRT_MAX);
+        }
+
+        if ((channel->position += count) >= channel->length)
+            channel->data = NULL;
+    }
+}
+
+// Convert a volume (0 to MAX_SFX_VOLUME) and separation (0 to 254) into the 8.8 fixed-point
+// gains used by the software mixer, matching what Mix_SetPanning() would do.
+static void I_SetMixChannelParams(int channel, int vol, int sep)
+{
+    mixchannels[channel].leftvol = (254 - sep) * vol / 128 * 256 / 255;
+    mixchannels[channel].rightvol = sep * vol / 128 * 256 / 255;
+}
+
+// Queue a change in volume and separation for a channel. All queued changes are applied at once
+// by I_ApplySoundParams() so that the audio device is only locked once per tic.
 void I_UpdateSoundParams(int channel, int vol, int sep)
 {
-    Mix_SetPanning(channel, (254 - sep) * vol / 128, sep * vol / 128);
+    soundparams_t   *params;
+
+    if (numpendingparams == s_channels_max)
+        I_ApplySoundParams();
+
+    params = &pendingparams[numpendingparams++];
+
+    params->channel = channel;
+    params->vol = vol;
+    params->sep = sep;
+}
+
+void I_ApplySoundParams(void)
+{
+    if (!numpendingparams)
+        return;
+
+    SDL_LockAudio();
+
+    for (int i = 0; i < numpendingparams; i++)
+    {
+        soundparams_t   *params = &pendingparams[i];
+
+        if (softmixer)
+            I_SetMixChannelParams(params->channel, params->vol, params->sep);
+        else
+            // SDL's audio lock is recursive, so this doesn't block
+            Mix_SetPanning(params->channel, (254 - params->sep) * params->vol / 128, params->sep * params->vol / 128);
+    }
+
+    SDL_UnlockAudio();
+    numpendingparams = 0;
 }
 
 //
@@ -333,13 +463,25 @@ int I_StartSound(sfxinfo_t *sfxinfo, int channel, int vol, int sep, int pitch)
     else
         LockAllocatedSound(snd);
 
-    // play sound
-    Mix_PlayChannel(channel, &snd->chunk, 0);
-
     channels_playing[channel] = snd;
 
-    // set separation, etc.
-    I_UpdateSoundParams(channel, vol, sep);
+    // play sound, and set separation, etc.
+    if (softmixer)
+    {
+        mixchannel_t    *mixchannel = &mixchannels[channel];
+
+        SDL_LockAudio();
+        mixchannel->data = (int16_t *)snd->chunk.abuf;
+        mixchannel->length = snd->chunk.alen / 4;
+        mixchannel->position = 0;
+        I_SetMixChannelParams(channel, vol, sep);
+        SDL_UnlockAudio();
+    }
+    else
+    {
+        Mix_PlayChannel(channel, &snd->chunk, 0);
+        Mix_SetPanning(channel, (254 - sep) * vol / 128, sep * vol / 128);
+    }
 
     return channel;
 }
@@ -352,7 +494,7 @@ void I_StopSound(int channel)
 
 dboolean I_SoundIsPlaying(int channel)
 {
-    return Mix_Playing(channel);
+    return (softmixer ? !!mixchannels[channel].data : Mix_Playing(channel));
 }
 
 // Periodically called to update the sound system
@@ -367,6 +509,15 @@ void I_UpdateSound(void)
 
 dboolean I_AnySoundStillPlaying(void)
 {
+    if (softmixer)
+    {
+        for (int i = 0; i < s_channels_max; i++)
+            if (mixchannels[i].data)
+                return true;
+
+        return false;
+    }
+
     return Mix_Playing(-1);
 }
 
@@ -375,6 +526,9 @@ void I_ShutdownSound(void)
     if (!sound_initialized)
         return;
 
+    if (softmixer)
+        Mix_SetPostMix(NULL, NULL);
+
     Mix_CloseAudio();
     SDL_QuitSubSystem(SDL_INIT_AUDIO);
     sound_initialized = false;
@@ -388,7 +542,10 @@ dboolean I_InitSound(void)
 
     // No sounds yet
     for (int i = 0; i < s_channels_max; i++)
+    {
         channels_playing[i] = NULL;
+        mixchannels[i].data = NULL;
+    }
 
     if (SDL_InitSubSystem(SDL_INIT_AUDIO) < 0)
         return false;
@@ -407,7 +564,21 @@ dboolean I_InitSound(void)
     if (!Mix_QuerySpec(&mixer_freq, &mixer_format, &mixer_channels))
         return false;
 
-    Mix_AllocateChannels(s_channels_max);
+    // The software mixer only handles signed 16-bit stereo output
+    if (softmixer && (mixer_format != AUDIO_S16SYS || mixer_channels != 2))
+    {
+        C_Warning(1, "The software mixer couldn't be used with this audio device.");
+        softmixer = false;
+    }
+
+    if (softmixer)
+    {
+        Mix_AllocateChannels(0);
+        Mix_SetPostMix(I_SoftMixer, NULL);
+    }
+    else
+        Mix_AllocateChannels(s_channels_max);
+
     SDL_PauseAudio(0);
     sound_initialized = true;
 
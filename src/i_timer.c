@@ -36,9 +36,22 @@
 ========================================================================
 */
 
+#if !defined(_WIN32)
+#include <errno.h>
+#include <time.h>
+#endif
+
 #include "SDL.h"
 
 #include "doomdef.h"
+#include "i_timer.h"
+
+// how long before a deadline to stop sleeping and start spinning, to absorb the OS oversleeping
+#if defined(_WIN32)
+#define SPINTIME    2000000
+#else
+#define SPINTIME    500000
+#endif
 
 //
 // I_GetTime
@@ -65,6 +78,114 @@ void I_Sleep(int ms)
     SDL_Delay(ms);
 }
 
+//
+// Returns a monotonic time in nanoseconds
+//
+uint64_t I_GetTimeNS(void)
+{
+#if defined(_WIN32)
+    static uint64_t frequency;
+    const uint64_t  counter = SDL_GetPerformanceCounter();
+
+    if (!frequency)
+        frequency = SDL_GetPerformanceFrequency();
+
+    return (counter / frequency * 1000000000 + counter % frequency * 1000000000 / frequency);
+#else
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return ((uint64_t)now.tv_sec * 1000000000 + now.tv_nsec);
+#endif
+}
+
+//
+// Sleep until a time returned by I_GetTimeNS(), spinning for the last
+// SPINTIME nanoseconds so the deadline isn't overshot
+//
+void I_SleepUntilNS(uint64_t deadline)
+{
+    uint64_t    now = I_GetTimeNS();
+
+    if (deadline > now + SPINTIME)
+    {
+#if defined(_WIN32)
+        SDL_Delay((Uint32)((deadline - now - SPINTIME) / 1000000));
+#elif defined(__APPLE__)
+        struct timespec duration;
+        const uint64_t  sleeptime = deadline - now - SPINTIME;
+
+        duration.tv_sec = sleeptime / 1000000000;
+        duration.tv_nsec = sleeptime % 1000000000;
+        nanosleep(&duration, NULL);
+#else
+        struct timespec wake;
+        const uint64_t  waketime = deadline - SPINTIME;
+
+        wake.tv_sec = waketime / 1000000000;
+        wake.tv_nsec = waketime % 1000000000;
+
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wake, NULL) == EINTR);
+#endif
+    }
+
+    while (I_GetTimeNS() < deadline);
+}
+
+#if defined(PROFILER)
+profile_t   profiles[NUMPROFILES] =
+{
+    { "G_Ticker",           0 },
+    { "P_RunThinkers",      1 },
+    { "S_UpdateSounds",     0 },
+    { "R_RenderPlayerView", 0 },
+    { "R_InterpolateFrame", 1 },
+    { "R_RenderBSPNode",    1 },
+    { "R_DrawPlanes",       1 },
+    { "R_DrawMasked",       1 },
+    { "AM_Drawer",          0 },
+    { "ST_Drawer",          0 },
+    { "HU_Drawer",          0 },
+    { "I_Blit",             0 }
+};
+
+uint64_t    profileframetimes[PROFILEFRAMES];
+int         numprofileframes;
+
+void I_StartProfile(profilesection_t section)
+{
+    profiles[section].start = I_GetTimeNS();
+}
+
+void I_EndProfile(profilesection_t section)
+{
+    profiles[section].time += I_GetTimeNS() - profiles[section].start;
+}
+
+//
+// Called once a frame to add the time spent in each section since the last call
+// to its history, keeping a running total of the last PROFILEFRAMES frames
+//
+void I_UpdateProfiles(void)
+{
+    static uint64_t lastframe;
+    const uint64_t  now = I_GetTimeNS();
+    const int       frame = numprofileframes++ % PROFILEFRAMES;
+
+    for (int i = 0; i < NUMPROFILES; i++)
+    {
+        profile_t   *profile = &profiles[i];
+
+        profile->total += profile->time - profile->history[frame];
+        profile->history[frame] = profile->time;
+        profile->time = 0;
+    }
+
+    profileframetimes[frame] = (lastframe ? now - lastframe : 0);
+    lastframe = now;
+}
+#endif
+
 void I_InitTimer(void)
 {
     // initialize timer
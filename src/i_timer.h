@@ -39,6 +39,8 @@
 #if !defined(__I_TIMER_H__)
 #define __I_TIMER_H__
 
+#include "doomtype.h"
+
 // Called by D_DoomLoop,
 // returns current time in tics.
 int I_GetTime(void);
@@ -46,12 +48,70 @@ int I_GetTime(void);
 // returns current time in ms
 int I_GetTimeMS(void);
 
+// returns current time in ns
+uint64_t I_GetTimeNS(void);
+
 // Pause for a specified number of ms
 void I_Sleep(int ms);
 
+// Pause until a time returned by I_GetTimeNS()
+void I_SleepUntilNS(uint64_t deadline);
+
 // Initialize timer
 void I_InitTimer(void);
 
 void I_ShutdownTimer(void);
 
+// The profiler is only compiled into debug builds, or when PROFILER is defined
+#if defined(_DEBUG) && !defined(PROFILER)
+#define PROFILER
+#endif
+
+#if defined(PROFILER)
+#define PROFILEFRAMES   256
+
+typedef enum
+{
+    PROFILE_G_TICKER,
+    PROFILE_P_RUNTHINKERS,
+    PROFILE_S_UPDATESOUNDS,
+    PROFILE_R_RENDERPLAYERVIEW,
+    PROFILE_R_INTERPOLATEFRAME,
+    PROFILE_R_RENDERBSPNODE,
+    PROFILE_R_DRAWPLANES,
+    PROFILE_R_DRAWMASKED,
+    PROFILE_AM_DRAWER,
+    PROFILE_ST_DRAWER,
+    PROFILE_HU_DRAWER,
+    PROFILE_I_BLIT,
+    NUMPROFILES
+} profilesection_t;
+
+typedef struct
+{
+    const char  *name;
+    int         depth;
+    uint64_t    start;
+    uint64_t    time;
+    uint64_t    total;
+    uint64_t    history[PROFILEFRAMES];
+} profile_t;
+
+extern profile_t    profiles[NUMPROFILES];
+extern uint64_t     profileframetimes[PROFILEFRAMES];
+extern int          numprofileframes;
+
+void I_StartProfile(profilesection_t section);
+void I_EndProfile(profilesection_t section);
+void I_UpdateProfiles(void);
+
+#define PROFILE_START(section)  I_StartProfile(section)
+#define PROFILE_END(section)    I_EndProfile(section)
+#define PROFILE_FRAME()         I_UpdateProfiles()
+#else
+#define PROFILE_START(section)
+#define PROFILE_END(section)
+#define PROFILE_FRAME()
+#endif
+
 #endif
@@ -38,7 +38,6 @@
 
 #if defined(_WIN32)
 #include <Windows.h>
-#include <mmsystem.h>
 
 #include "SDL_syswm.h"
 #elif defined(X11)
@@ -70,8 +69,6 @@
 #define MAXUPSCALEWIDTH     (1600 / ORIGINALWIDTH)
 #define MAXUPSCALEHEIGHT    (1200 / ORIGINALHEIGHT)
 
-#define SHAKEANGLE          ((double)M_RandomInt(-1000, 1000) * r_shake_damage / 100000.0)
-
 #if !defined(SDL_VIDEO_RENDER_D3D11)
 #define SDL_VIDEO_RENDER_D3D11  0
 #endif
@@ -93,6 +90,7 @@ char                *vid_scaleapi = vid_scaleapi_default;
 char                *vid_scalefilter = vid_scalefilter_default;
 char                *vid_screenresolution = vid_screenresolution_default;
 dboolean            vid_showfps = vid_showfps_default;
+dboolean            vid_showprofile = vid_showprofile_default;
 dboolean            vid_vsync = vid_vsync_default;
 dboolean            vid_widescreen = vid_widescreen_default;
 char                *vid_windowpos = vid_windowpos_default;
@@ -184,9 +182,10 @@ static SDL_Rect     map_rect;
 int                 framespersecond;
 int                 refreshrate;
 
-#if defined(_WIN32)
-HANDLE              CapFPSEvent;
-#endif
+int                 vid_frametimejitter;
+
+static uint64_t     capfpsperiod;
+static uint64_t     framedeadline;
 
 static dboolean     capslock;
 dboolean            alwaysrun = alwaysrun_default;
@@ -305,40 +304,70 @@ dboolean keystate(int key)
 
 void I_CapFPS(int cap)
 {
-#if defined(_WIN32)
-    static UINT CapFPSTimer;
+    capfpsperiod = (cap ? 1000000000 / cap : 0);
+    framedeadline = 0;
+}
 
-    if (CapFPSTimer)
-    {
-        timeKillEvent(CapFPSTimer);
-        CapFPSTimer = 0;
-    }
+//
+// I_WaitForFrame
+// Called once a frame by D_DoomLoop to hold the framerate to vid_capfps,
+// and to measure how much the time between frames varies
+//
+#define FRAMETIMES  64
 
-    if (!cap || cap == TICRATE)
+void I_WaitForFrame(void)
+{
+    static int64_t  frametimes[FRAMETIMES];
+    static int64_t  frametimessum;
+    static int64_t  frametimessumsq;
+    static int      frametimeindex;
+    static int      numframetimes;
+    static uint64_t lastframetime;
+    uint64_t        period = capfpsperiod;
+    uint64_t        now = I_GetTimeNS();
+    int64_t         frametime;
+    int64_t         variance;
+
+    // don't let an uncapped framerate use a whole core when nothing needs it
+    if (!period && !refreshrate && (gamestate != GS_LEVEL || menuactive || paused))
+        period = 1000000000 / vid_capfps_default;
+
+    if (period)
     {
-        if (CapFPSEvent)
+        framedeadline += period;
+
+        // resync if we've fallen behind rather than trying to catch up
+        if (framedeadline < now)
+            framedeadline = now;
+        else
         {
-            CloseHandle(CapFPSEvent);
-            CapFPSEvent = NULL;
+            I_SleepUntilNS(framedeadline);
+            now = I_GetTimeNS();
         }
     }
-    else
+
+    if (lastframetime)
     {
-        if (!CapFPSEvent)
-            CapFPSEvent = CreateEvent(NULL, FALSE, TRUE, NULL);
+        frametime = (int64_t)(now - lastframetime) / 1000;
 
-        if (CapFPSEvent)
+        if (numframetimes == FRAMETIMES)
         {
-            CapFPSTimer = timeSetEvent(1000 / cap, 0, (LPTIMECALLBACK)CapFPSEvent, 0, (TIME_PERIODIC | TIME_CALLBACK_EVENT_SET));
-
-            if (!CapFPSTimer)
-            {
-                CloseHandle(CapFPSEvent);
-                CapFPSEvent = NULL;
-            }
+            frametimessum -= frametimes[frametimeindex];
+            frametimessumsq -= frametimes[frametimeindex] * frametimes[frametimeindex];
         }
+        else
+            numframetimes++;
+
+        frametimes[frametimeindex] = frametime;
+        frametimessum += frametime;
+        frametimessumsq += frametime * frametime;
+        frametimeindex = (frametimeindex + 1) % FRAMETIMES;
+
+        variance = (frametimessumsq - frametimessum * frametimessum / numframetimes) / numframetimes;
+        vid_frametimejitter = (int)sqrt((double)MAX(0, variance));
     }
-#endif
+
+    lastframetime = now;
 }
 
 static void FreeSurfaces(void)
@@ -784,6 +813,45 @@ static void GetUpscaledTextureSize(int width, int height)
 void (*blitfunc)(void);
 void (*mapblitfunc)(void);
 
+// how much of each new frame is blended with the last when vid_motionblur
+//  is on, out of 256, or 0 when off
+static int  motionblur;
+
+//
+// BlitSurface
+// Convert the 8-bit screen to 32-bit ready to be uploaded to the GPU. When
+//  there's motion blur, the previous frame is still in the 32-bit buffer, so the
+//  new frame is blended into it directly. Each pair of channels is blended at once
+//  in a single 32-bit integer, which compilers can vectorize.
+//
+static void BlitSurface(void)
+{
+    if (motionblur)
+    {
+        const byte  *src = surface->pixels;
+        uint32_t    *dest = buffer->pixels;
+        const int   size = SCREENWIDTH * SCREENHEIGHT;
+        const int   alpha = motionblur;
+        const int   beta = 256 - motionblur;
+        SDL_Color   *palettecolors = palette->colors;
+        uint32_t    palette32[256];
+
+        for (int i = 0; i < 256; i++)
+            palette32[i] = SDL_MapRGB(buffer->format, palettecolors[i].r, palettecolors[i].g, palettecolors[i].b);
+
+        for (int i = 0; i < size; i++)
+        {
+            const uint32_t  a = palette32[src[i]];
+            const uint32_t  b = dest[i];
+
+            dest[i] = ((((a & 0x00FF00FF) * alpha + (b & 0x00FF00FF) * beta) >> 8) & 0x00FF00FF)
+                | ((((a >> 8) & 0x00FF00FF) * alpha + ((b >> 8) & 0x00FF00FF) * beta) & 0xFF00FF00);
+        }
+    }
+    else
+        SDL_LowerBlit(surface, &src_rect, buffer, &src_rect);
+}
+
 void nullfunc(void) {}
 
 static uint64_t performancefrequency;
@@ -809,7 +877,7 @@ static void CalculateFPS(void)
 #if defined(_WIN32)
 void I_WindowResizeBlit(void)
 {
-    SDL_LowerBlit(surface, &src_rect, buffer, &src_rect);
+    BlitSurface();
     SDL_UpdateTexture(texture, &src_rect, buffer->pixels, SCREENWIDTH * 4);
     SDL_RenderClear(renderer);
 
@@ -827,125 +895,83 @@ void I_WindowResizeBlit(void)
 }
 #endif
 
+static dboolean blitshake;
+static dboolean blitshowfps;
+static dboolean blitshowprofile;
+static dboolean blitshowstats;
+static dboolean blitnearestlinear;
+
+//
+// I_Blit
+// When the player is being shaken, the screen is copied once to a destination at a
+//  random offset, rather than being copied a second time rotated over itself.
+//
 static void I_Blit(void)
 {
-    UpdateGrab();
+    SDL_Rect    *rect = NULL;
+    SDL_Rect    shake_rect;
 
-    SDL_LowerBlit(surface, &src_rect, buffer, &src_rect);
-    SDL_UpdateTexture(texture, &src_rect, buffer->pixels, SCREENWIDTH * 4);
-    SDL_RenderClear(renderer);
-    SDL_RenderCopy(renderer, texture, &src_rect, NULL);
-    SDL_RenderPresent(renderer);
-}
-
-static void I_Blit_NearestLinear(void)
-{
     UpdateGrab();
 
-    SDL_LowerBlit(surface, &src_rect, buffer, &src_rect);
-    SDL_UpdateTexture(texture, &src_rect, buffer->pixels, SCREENWIDTH * 4);
-    SDL_RenderClear(renderer);
-    SDL_SetRenderTarget(renderer, texture_upscaled);
-    SDL_RenderCopy(renderer, texture, &src_rect, NULL);
-    SDL_SetRenderTarget(renderer, NULL);
-    SDL_RenderCopy(renderer, texture_upscaled, NULL, NULL);
-    SDL_RenderPresent(renderer);
-}
+    if (blitshowfps)
+        CalculateFPS();
 
-static void I_Blit_ShowFPS(void)
-{
-    UpdateGrab();
-    CalculateFPS();
-
-    SDL_LowerBlit(surface, &src_rect, buffer, &src_rect);
-    SDL_UpdateTexture(texture, &src_rect, buffer->pixels, SCREENWIDTH * 4);
-    SDL_RenderClear(renderer);
-    SDL_RenderCopy(renderer, texture, &src_rect, NULL);
-    SDL_RenderPresent(renderer);
-}
+    if (blitshowprofile)
+        C_UpdateProfile();
 
-static void I_Blit_NearestLinear_ShowFPS(void)
-{
-    UpdateGrab();
-    CalculateFPS();
-
-    SDL_LowerBlit(surface, &src_rect, buffer, &src_rect);
-    SDL_UpdateTexture(texture, &src_rect, buffer->pixels, SCREENWIDTH * 4);
-    SDL_RenderClear(renderer);
-    SDL_SetRenderTarget(renderer, texture_upscaled);
-    SDL_RenderCopy(renderer, texture, &src_rect, NULL);
-    SDL_SetRenderTarget(renderer, NULL);
-    SDL_RenderCopy(renderer, texture_upscaled, NULL, NULL);
-    SDL_RenderPresent(renderer);
-}
+    if (blitshowstats)
+        C_UpdateRenderStats();
 
-static void I_Blit_Shake(void)
-{
-    UpdateGrab();
+    // time the copy to the screen, but not the overlays drawn over it or waiting for vsync
+    PROFILE_START(PROFILE_I_BLIT);
 
-    SDL_LowerBlit(surface, &src_rect, buffer, &src_rect);
+    BlitSurface();
     SDL_UpdateTexture(texture, &src_rect, buffer->pixels, SCREENWIDTH * 4);
     SDL_RenderClear(renderer);
-    SDL_RenderCopy(renderer, texture, &src_rect, NULL);
-    SDL_RenderCopyEx(renderer, texture, &src_rect, NULL, SHAKEANGLE, NULL, SDL_FLIP_NONE);
-    SDL_RenderPresent(renderer);
-}
 
-static void I_Blit_NearestLinear_Shake(void)
-{
-    UpdateGrab();
-
-    SDL_LowerBlit(surface, &src_rect, buffer, &src_rect);
-    SDL_UpdateTexture(texture, &src_rect, buffer->pixels, SCREENWIDTH * 4);
-    SDL_RenderClear(renderer);
-    SDL_SetRenderTarget(renderer, texture_upscaled);
-    SDL_RenderCopy(renderer, texture, &src_rect, NULL);
-    SDL_RenderCopyEx(renderer, texture, &src_rect, NULL, SHAKEANGLE, NULL, SDL_FLIP_NONE);
-    SDL_SetRenderTarget(renderer, NULL);
-    SDL_RenderCopy(renderer, texture_upscaled, NULL, NULL);
-    SDL_RenderPresent(renderer);
-}
+    if (blitshake)
+    {
+        const int   margin = r_shake_damage * 3 * SCREENSCALE / 100;
 
-static void I_Blit_ShowFPS_Shake(void)
-{
-    UpdateGrab();
-    CalculateFPS();
+        if (margin)
+        {
+            // the logical size changes with vid_widescreen
+            SDL_RenderGetLogicalSize(renderer, &shake_rect.w, &shake_rect.h);
+            shake_rect.x = M_RandomInt(-margin, margin);
+            shake_rect.y = M_RandomInt(-margin, margin);
+            rect = &shake_rect;
+        }
+    }
 
-    SDL_LowerBlit(surface, &src_rect, buffer, &src_rect);
-    SDL_UpdateTexture(texture, &src_rect, buffer->pixels, SCREENWIDTH * 4);
-    SDL_RenderClear(renderer);
-    SDL_RenderCopy(renderer, texture, &src_rect, NULL);
-    SDL_RenderCopyEx(renderer, texture, &src_rect, NULL, SHAKEANGLE, NULL, SDL_FLIP_NONE);
-    SDL_RenderPresent(renderer);
-}
+    if (blitnearestlinear)
+    {
+        SDL_SetRenderTarget(renderer, texture_upscaled);
+        SDL_RenderCopy(renderer, texture, &src_rect, NULL);
+        SDL_SetRenderTarget(renderer, NULL);
+        SDL_RenderCopy(renderer, texture_upscaled, NULL, rect);
+    }
+    else
+        SDL_RenderCopy(renderer, texture, &src_rect, rect);
 
-static void I_Blit_NearestLinear_ShowFPS_Shake(void)
-{
-    UpdateGrab();
-    CalculateFPS();
+    PROFILE_END(PROFILE_I_BLIT);
 
-    SDL_LowerBlit(surface, &src_rect, buffer, &src_rect);
-    SDL_UpdateTexture(texture, &src_rect, buffer->pixels, SCREENWIDTH * 4);
-    SDL_RenderClear(renderer);
-    SDL_SetRenderTarget(renderer, texture_upscaled);
-    SDL_RenderCopy(renderer, texture, &src_rect, NULL);
-    SDL_RenderCopyEx(renderer, texture, &src_rect, NULL, SHAKEANGLE, NULL, SDL_FLIP_NONE);
-    SDL_SetRenderTarget(renderer, NULL);
-    SDL_RenderCopy(renderer, texture_upscaled, NULL, NULL);
     SDL_RenderPresent(renderer);
 }
 
 void I_Blit_Automap(void)
 {
+    PROFILE_START(PROFILE_I_BLIT);
     SDL_LowerBlit(mapsurface, &map_rect, mapbuffer, &map_rect);
     SDL_UpdateTexture(maptexture, &map_rect, mapbuffer->pixels, SCREENWIDTH * 4);
     SDL_RenderClear(maprenderer);
     SDL_RenderCopy(maprenderer, maptexture, &map_rect, NULL);
+    PROFILE_END(PROFILE_I_BLIT);
     SDL_RenderPresent(maprenderer);
 }
 
 void I_Blit_Automap_NearestLinear(void)
 {
+    PROFILE_START(PROFILE_I_BLIT);
     SDL_LowerBlit(mapsurface, &map_rect, mapbuffer, &map_rect);
     SDL_UpdateTexture(maptexture, &map_rect, mapbuffer->pixels, SCREENWIDTH * 4);
     SDL_RenderClear(maprenderer);
@@ -953,6 +979,7 @@ void I_Blit_Automap_NearestLinear(void)
     SDL_RenderCopy(maprenderer, maptexture, &map_rect, NULL);
     SDL_SetRenderTarget(maprenderer, NULL);
     SDL_RenderCopy(maprenderer, maptexture_upscaled, NULL, NULL);
+    PROFILE_END(PROFILE_I_BLIT);
     SDL_RenderPresent(maprenderer);
 }
 
@@ -960,12 +987,12 @@ void I_UpdateBlitFunc(dboolean shake)
 {
     dboolean    override = (vid_fullscreen && !(displayheight % ORIGINALHEIGHT));
 
-    if (shake && !software)
-        blitfunc = (vid_showfps ? (nearestlinear && !override ? I_Blit_NearestLinear_ShowFPS_Shake :
-            I_Blit_ShowFPS_Shake) : (nearestlinear && !override ? I_Blit_NearestLinear_Shake : I_Blit_Shake));
-    else
-        blitfunc = (vid_showfps ? (nearestlinear && !override ? I_Blit_NearestLinear_ShowFPS : I_Blit_ShowFPS) :
-            (nearestlinear && !override ? I_Blit_NearestLinear : I_Blit));
+    blitshake = (shake && !software);
+    blitshowfps = vid_showfps;
+    blitshowprofile = vid_showprofile;
+    blitshowstats = r_showstats;
+    blitnearestlinear = (nearestlinear && !override);
+    blitfunc = I_Blit;
 
     mapblitfunc = (mapwindow ? (nearestlinear && !override ? I_Blit_Automap_NearestLinear : I_Blit_Automap) : nullfunc);
 }
@@ -1312,16 +1339,7 @@ static void PositionOnCurrentDisplay(void)
 
 void I_SetMotionBlur(int percent)
 {
-    if (percent)
-    {
-        SDL_SetSurfaceAlphaMod(surface, SDL_ALPHA_OPAQUE - 128 * percent / 100);
-        SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_BLEND);
-    }
-    else
-    {
-        SDL_SetSurfaceAlphaMod(surface, SDL_ALPHA_OPAQUE);
-        SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE);
-    }
+    motionblur = (percent ? MAX(1, 256 - 128 * percent / 100) : 0);
 }
 
 static void SetVideoMode(dboolean output)
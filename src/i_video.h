@@ -58,6 +58,7 @@ void I_InitGraphics(void);
 void I_RestartGraphics(void);
 void I_ShutdownGraphics(void);
 void I_CapFPS(int frames);
+void I_WaitForFrame(void);
 
 void GetWindowPosition(void);
 void GetWindowSize(void);
@@ -56,7 +56,7 @@ extern char     *packageconfig;
 extern dboolean vanilla;
 extern dboolean togglingvanilla;
 
-#define NUMCVARS                                    178
+#define NUMCVARS                                    180
 
 #define CONFIG_VARIABLE_INT(name, set)              { #name, &name, DEFAULT_INT,           set          }
 #define CONFIG_VARIABLE_INT_UNSIGNED(name, set)     { #name, &name, DEFAULT_INT_UNSIGNED,  set          }
@@ -146,6 +146,7 @@ static default_t cvars[NUMCVARS] =
     CONFIG_VARIABLE_INT          (r_detail,                                          DETAILVALUEALIAS   ),
     CONFIG_VARIABLE_INT          (r_diskicon,                                        BOOLVALUEALIAS     ),
     CONFIG_VARIABLE_INT          (r_dither,                                          BOOLVALUEALIAS     ),
+    CONFIG_VARIABLE_INT          (r_dynamicresolution,                               CAPVALUEALIAS      ),
     CONFIG_VARIABLE_INT          (r_fixmaperrors,                                    BOOLVALUEALIAS     ),
     CONFIG_VARIABLE_INT          (r_fixspriteoffsets,                                BOOLVALUEALIAS     ),
     CONFIG_VARIABLE_INT          (r_floatbob,                                        BOOLVALUEALIAS     ),
@@ -162,6 +163,7 @@ static default_t cvars[NUMCVARS] =
     CONFIG_VARIABLE_OTHER        (r_lowpixelsize,                                    NOVALUEALIAS       ),
     CONFIG_VARIABLE_INT          (r_mirroredweapons,                                 BOOLVALUEALIAS     ),
     CONFIG_VARIABLE_INT          (r_playersprites,                                   BOOLVALUEALIAS     ),
+    CONFIG_VARIABLE_INT          (r_pvs,                                             BOOLVALUEALIAS     ),
     CONFIG_VARIABLE_INT          (r_rockettrails,                                    BOOLVALUEALIAS     ),
     CONFIG_VARIABLE_INT          (r_screensize,                                      NOVALUEALIAS       ),
     CONFIG_VARIABLE_INT          (r_shadows,                                         BOOLVALUEALIAS     ),
@@ -749,6 +751,8 @@ static void M_CheckCVARs(void)
     if (r_dither != false && r_dither != true)
         r_dither = r_dither_default;
 
+    r_dynamicresolution = BETWEEN(r_dynamicresolution_min, r_dynamicresolution, r_dynamicresolution_max);
+
     if (r_fixmaperrors != false && r_fixmaperrors != true)
         r_fixmaperrors = r_fixmaperrors_default;
 
@@ -793,6 +797,9 @@ static void M_CheckCVARs(void)
     if (r_playersprites != false && r_playersprites != true)
         r_playersprites = r_playersprites_default;
 
+    if (r_pvs != false && r_pvs != true)
+        r_pvs = r_pvs_default;
+
     if (r_rockettrails != false && r_rockettrails != true)
         r_rockettrails = r_rockettrails_default;
 
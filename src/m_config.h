@@ -99,6 +99,7 @@ extern dboolean     mouselook;
 extern int          movebob;
 extern char         *playername;
 extern dboolean     r_althud;
+extern int          r_animupdates;
 extern int          r_berserkintensity;
 extern int          r_blood;
 extern int          r_bloodsplats_max;
@@ -115,6 +116,13 @@ extern dboolean     r_corpses_smearblood;
 extern int          r_detail;
 extern dboolean     r_diskicon;
 extern dboolean     r_dither;
+extern int          r_drawsegtests;
+extern int          r_drawsegtests_skipped;
+extern int          r_dynamicresolution;
+extern int          r_dynamicresolution_budget;
+extern int          r_dynamicresolution_rendertime;
+extern int          r_dynamicresolution_scale;
+extern int          r_dynamicresolution_step;
 extern dboolean     r_fixmaperrors;
 extern dboolean     r_fixspriteoffsets;
 extern dboolean     r_floatbob;
@@ -128,16 +136,33 @@ extern dboolean     r_liquid_clipsprites;
 extern dboolean     r_liquid_current;
 extern dboolean     r_liquid_lowerview;
 extern dboolean     r_liquid_swirl;
+extern int          r_liquid_warps;
 extern char         *r_lowpixelsize;
 extern dboolean     r_mirroredweapons;
+extern dboolean     r_occlusion;
 extern dboolean     r_playersprites;
+extern dboolean     r_pvs;
 extern dboolean     r_rockettrails;
 extern int          r_screensize;
 extern dboolean     r_shadows;
 extern dboolean     r_shadows_translucency;
 extern dboolean     r_shake_barrels;
 extern int          r_shake_damage;
+extern dboolean     r_showstats;
 extern int          r_skycolor;
+extern int          r_stats_drawsegs;
+extern int          r_stats_maskedposts;
+extern int          r_stats_nodes;
+extern int          r_stats_pvsculled;
+extern int          r_stats_segs;
+extern int          r_stats_skycolumns;
+extern int          r_stats_spanpixels;
+extern int          r_stats_spriteposts;
+extern int          r_stats_subsectors;
+extern int          r_stats_visplanes;
+extern int          r_stats_visplanes_chain;
+extern int          r_stats_vissprites;
+extern int          r_stats_walldraws;
 extern dboolean     r_textures;
 extern dboolean     r_translucency;
 extern int          s_channels;
@@ -202,6 +227,7 @@ extern int          vid_display;
 #if !defined(_WIN32)
 extern char         *vid_driver;
 #endif
+extern int          vid_frametimejitter;
 extern dboolean     vid_fullscreen;
 extern int          vid_motionblur;
 extern dboolean     vid_pillarboxes;
@@ -209,6 +235,7 @@ extern char         *vid_scaleapi;
 extern char         *vid_scalefilter;
 extern char         *vid_screenresolution;
 extern dboolean     vid_showfps;
+extern dboolean     vid_showprofile;
 extern dboolean     vid_vsync;
 extern dboolean     vid_widescreen;
 extern char         *vid_windowpos;
@@ -451,6 +478,10 @@ enum
 
 #define r_althud_default                        false
 
+#define r_animupdates_min                       0
+#define r_animupdates_default                   0
+#define r_animupdates_max                       0
+
 #define r_berserkintensity_min                  0
 #define r_berserkintensity_default              2
 #define r_berserkintensity_max                  8
@@ -493,6 +524,34 @@ enum
 
 #define r_dither_default                        false
 
+#define r_drawsegtests_min                      0
+#define r_drawsegtests_default                  0
+#define r_drawsegtests_max                      0
+
+#define r_drawsegtests_skipped_min              0
+#define r_drawsegtests_skipped_default          0
+#define r_drawsegtests_skipped_max              0
+
+#define r_dynamicresolution_min                 0
+#define r_dynamicresolution_default             0
+#define r_dynamicresolution_max                 1000
+
+#define r_dynamicresolution_budget_min          0
+#define r_dynamicresolution_budget_default      0
+#define r_dynamicresolution_budget_max          0
+
+#define r_dynamicresolution_rendertime_min      0
+#define r_dynamicresolution_rendertime_default  0
+#define r_dynamicresolution_rendertime_max      0
+
+#define r_dynamicresolution_scale_min           0
+#define r_dynamicresolution_scale_default       0
+#define r_dynamicresolution_scale_max           0
+
+#define r_dynamicresolution_step_min            0
+#define r_dynamicresolution_step_default        0
+#define r_dynamicresolution_step_max            0
+
 #define r_fixmaperrors_default                  true
 
 #define r_fixspriteoffsets_default              true
@@ -523,12 +582,20 @@ enum
 
 #define r_liquid_swirl_default                  true
 
+#define r_liquid_warps_min                      0
+#define r_liquid_warps_default                  0
+#define r_liquid_warps_max                      0
+
 #define r_lowpixelsize_default                  "2x2"
 
 #define r_mirroredweapons_default               false
 
+#define r_occlusion_default                     true
+
 #define r_playersprites_default                 true
 
+#define r_pvs_default                           false
+
 #define r_rockettrails_default                  true
 
 #define r_screensize_min                        0
@@ -545,18 +612,72 @@ enum
 #define r_shake_damage_default                  50
 #define r_shake_damage_max                      100
 
+#define r_showstats_default                     false
+
 #define r_skycolor_none                         -1
 #define r_skycolor_min                          0
 #define r_skycolor_default                      r_skycolor_none
 #define r_skycolor_max                          255
 
+#define r_stats_drawsegs_min                    0
+#define r_stats_drawsegs_default                0
+#define r_stats_drawsegs_max                    0
+
+#define r_stats_maskedposts_min                 0
+#define r_stats_maskedposts_default             0
+#define r_stats_maskedposts_max                 0
+
+#define r_stats_nodes_min                       0
+#define r_stats_nodes_default                   0
+#define r_stats_nodes_max                       0
+
+#define r_stats_pvsculled_min                   0
+#define r_stats_pvsculled_default               0
+#define r_stats_pvsculled_max                   0
+
+#define r_stats_segs_min                        0
+#define r_stats_segs_default                    0
+#define r_stats_segs_max                        0
+
+#define r_stats_skycolumns_min                  0
+#define r_stats_skycolumns_default              0
+#define r_stats_skycolumns_max                  0
+
+#define r_stats_spanpixels_min                  0
+#define r_stats_spanpixels_default              0
+#define r_stats_spanpixels_max                  0
+
+#define r_stats_spriteposts_min                 0
+#define r_stats_spriteposts_default             0
+#define r_stats_spriteposts_max                 0
+
+#define r_stats_subsectors_min                  0
+#define r_stats_subsectors_default              0
+#define r_stats_subsectors_max                  0
+
+#define r_stats_visplanes_min                   0
+#define r_stats_visplanes_default               0
+#define r_stats_visplanes_max                   0
+
+#define r_stats_visplanes_chain_min             0
+#define r_stats_visplanes_chain_default         0
+#define r_stats_visplanes_chain_max             0
+
+#define r_stats_vissprites_min                  0
+#define r_stats_vissprites_default              0
+#define r_stats_vissprites_max                  0
+
+#define r_stats_walldraws_min                   0
+#define r_stats_walldraws_default               0
+#define r_stats_walldraws_max                   0
+
 #define r_textures_default                      true
 
 #define r_translucency_default                  true
 
 #define s_channels_min                          8
 #define s_channels_default                      32
-#define s_channels_max                          64
+#define s_channels_max                          256
 
 #define s_musicvolume_min                       0
 #define s_musicvolume_default                   67
@@ -608,6 +729,10 @@ enum
 #define vid_driver_default                      ""
 #endif
 
+#define vid_frametimejitter_min                 0
+#define vid_frametimejitter_default             0
+#define vid_frametimejitter_max                 0
+
 #define vid_fullscreen_default                  true
 
 #define vid_motionblur_min                      0
@@ -638,6 +763,8 @@ enum
 
 #define vid_showfps_default                     false
 
+#define vid_showprofile_default                 false
+
 #define vid_vsync_default                       true
 
 #define vid_widescreen_default                  false
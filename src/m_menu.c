@@ -456,44 +456,26 @@ menu_t SaveDef =
     load1
 };
 
-static int blurheight;
+// random amounts each pixel is darkened by when blurred behind the menu,
+//  starting from a different point each tic
+#define DITHERSIZE  65536
 
-static void BlurScreen(byte *screen, byte *blurscreen)
-{
-    for (int i = 0; i < blurheight; i++)
-        blurscreen[i] = grays[screen[i]];
-
-    for (int y = 0; y <= blurheight - SCREENWIDTH; y += SCREENWIDTH)
-        for (int x = y; x <= y + SCREENWIDTH - 2; x++)
-            blurscreen[x] = tinttab50[blurscreen[x] + (blurscreen[x + 1] << 8)];
-
-    for (int y = 0; y <= blurheight - SCREENWIDTH; y += SCREENWIDTH)
-        for (int x = y + SCREENWIDTH - 2; x >= y; x--)
-            blurscreen[x] = tinttab50[blurscreen[x] + (blurscreen[x - 1] << 8)];
+static byte dither[DITHERSIZE];
 
-    for (int y = 0; y <= blurheight - SCREENWIDTH * 2; y += SCREENWIDTH)
-        for (int x = y; x <= y + SCREENWIDTH - 2; x++)
-            blurscreen[x] = tinttab50[blurscreen[x] + (blurscreen[x + SCREENWIDTH + 1] << 8)];
+static byte *blurscreen1;
+static byte *blurscreen2;
 
-    for (int y = blurheight - SCREENWIDTH; y >= SCREENWIDTH; y -= SCREENWIDTH)
-        for (int x = y + SCREENWIDTH - 1; x >= y + 1; x--)
-            blurscreen[x] = tinttab50[blurscreen[x] + (blurscreen[x - SCREENWIDTH - 1] << 8)];
-
-    for (int y = 0; y <= blurheight - SCREENWIDTH * 2; y += SCREENWIDTH)
-        for (int x = y; x <= y + SCREENWIDTH - 1; x++)
-            blurscreen[x] = tinttab50[blurscreen[x] + (blurscreen[x + SCREENWIDTH] << 8)];
+static void BlurScreen(byte *screen, byte *blurscreen, int height)
+{
+    const int   offset = ((M_Random() << 8) | M_Random()) & (DITHERSIZE - 1);
 
-    for (int y = blurheight - SCREENWIDTH; y >= SCREENWIDTH; y -= SCREENWIDTH)
-        for (int x = y; x <= y + SCREENWIDTH - 1; x++)
-            blurscreen[x] = tinttab50[blurscreen[x] + (blurscreen[x - SCREENWIDTH] << 8)];
+    for (int i = 0; i < height; i++)
+        blurscreen[i] = grays[colormaps[0][(dither[(i + offset) & (DITHERSIZE - 1)] << 8) + screen[i]]];
 
-    for (int y = 0; y <= blurheight - SCREENWIDTH * 2; y += SCREENWIDTH)
-        for (int x = y + SCREENWIDTH - 1; x >= y + 1; x--)
-            blurscreen[x] = tinttab50[blurscreen[x] + (blurscreen[x + SCREENWIDTH - 1] << 8)];
+    V_BlurScreen(blurscreen, SCREENWIDTH, height / SCREENWIDTH);
 
-    for (int y = blurheight - SCREENWIDTH; y >= SCREENWIDTH; y -= SCREENWIDTH)
-        for (int x = y; x <= y + SCREENWIDTH - 2; x++)
-            blurscreen[x] = tinttab50[blurscreen[x] + (blurscreen[x - SCREENWIDTH + 1] << 8)];
+    for (int i = 0; i < height; i++)
+        blurscreen[i] = tinttab33[blurscreen[i]];
 }
 
 //
@@ -502,11 +484,8 @@ static void BlurScreen(byte *screen, byte *blurscreen)
 //
 void M_DarkBackground(void)
 {
-    static byte blurscreen1[SCREENWIDTH * SCREENHEIGHT];
-    static byte blurscreen2[(SCREENHEIGHT - SBARHEIGHT) * SCREENWIDTH];
     static int  prevtic = -1;
-
-    blurheight = (SCREENHEIGHT - (vid_widescreen && gamestate == GS_LEVEL) * SBARHEIGHT) * SCREENWIDTH;
+    const int   blurheight = (SCREENHEIGHT - (vid_widescreen && gamestate == GS_LEVEL) * SBARHEIGHT) * SCREENWIDTH;
 
     if (gametime != prevtic)
     {
@@ -518,13 +497,7 @@ void M_DarkBackground(void)
             screens[0][i + SCREENWIDTH - 1] = nearestblack;
         }
 
-        for (int i = 0; i < blurheight; i++)
-            screens[0][i] = colormaps[0][((M_Random() & 7) << 8) + screens[0][i]];
-
-        BlurScreen(screens[0], blurscreen1);
-
-        for (int i = 0; i < blurheight; i++)
-            blurscreen1[i] = tinttab33[blurscreen1[i]];
+        BlurScreen(screens[0], blurscreen1, blurheight);
 
         if (mapwindow)
         {
@@ -536,13 +509,7 @@ void M_DarkBackground(void)
                 mapscreen[i + SCREENWIDTH - 1] = nearestblack;
             }
 
-            for (int i = 0; i < (SCREENHEIGHT - SBARHEIGHT) * SCREENWIDTH; i++)
-                mapscreen[i] = colormaps[0][((M_Random() & 7) << 8) + mapscreen[i]];
-
-            BlurScreen(mapscreen, blurscreen2);
-
-            for (int i = 0; i < (SCREENHEIGHT - SBARHEIGHT) * SCREENWIDTH; i++)
-                blurscreen2[i] = tinttab33[blurscreen2[i]];
+            BlurScreen(mapscreen, blurscreen2, (SCREENHEIGHT - SBARHEIGHT) * SCREENWIDTH);
         }
 
         prevtic = gametime;
@@ -1562,8 +1529,8 @@ static void M_DrawMainMenu(void)
     else
     {
         int y = 11 + OFFSET;
-        int dot1 = screens[0][(y * SCREENWIDTH + 98) * 2];
-        int dot2 = screens[0][((y + 1) * SCREENWIDTH + 99) * 2];
+        int dot1 = screens[0][(y * SCREENWIDTH + 98) * SCREENSCALE];
+        int dot2 = screens[0][((y + 1) * SCREENWIDTH + 99) * SCREENSCALE];
 
         M_DrawCenteredPatchWithShadow(y, patch);
 
@@ -3753,6 +3720,12 @@ void M_Init(void)
     quickSaveSlot = -1;
     spindirection = ((M_Random() & 1) ? 1 : -1);
 
+    for (int i = 0; i < DITHERSIZE; i++)
+        dither[i] = M_Random() & 7;
+
+    blurscreen1 = malloc(SCREENWIDTH * SCREENHEIGHT);
+    blurscreen2 = malloc(SCREENWIDTH * SCREENHEIGHT);
+
     if (autostart)
     {
         episode = startepisode;
@@ -204,6 +204,7 @@ dboolean P_BlockThingsIterator(int x, int y, dboolean func(mobj_t *));
 #define PT_ADDTHINGS    2
 
 extern divline_t    dltrace;
+extern dboolean     sortintercepts;
 
 dboolean P_PathTraverse(fixed_t x1, fixed_t y1, fixed_t x2, fixed_t y2, int flags, traverser_t trav);
 
@@ -265,6 +266,8 @@ void P_MapEnd(void);
 // P_SETUP
 //
 extern const byte   *rejectmatrix;  // for fast sight rejection
+extern byte         *pvsmatrix;     // for finer sight rejection, or NULL
+extern byte         *pvsrows;       // for culling what can't be seen, or NULL
 extern int          *blockmaplump;
 extern int          *blockmap;
 extern int          bmapwidth;
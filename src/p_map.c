@@ -2078,39 +2078,63 @@ static void PIT_ChangeSector(mobj_t *thing)
     }
 }
 
+// things touching the sectors being changed by P_ChangeSector()
+static mobj_t   **changesectorthings;
+static int      numchangesectorthings;
+static int      maxchangesectorthings;
+
+static dboolean P_ThingTouchesSector(mobj_t *thing, sector_t *sector)
+{
+    for (msecnode_t *n = thing->touching_sectorlist; n; n = n->m_tnext)
+        if (n->m_sector == sector)
+            return true;
+
+    return false;
+}
+
 //
 // P_ChangeSector
 // jff 3/19/98 added to just check monsters on the periphery
 // of a moving sector instead of all in bounding box of the
 // sector. Both more accurate and faster.
 // [BH] renamed from P_CheckSector to P_ChangeSector to replace old one entirely
+// Rather than starting the scan of sector->touching_thinglist over after
+//  each thing, since PIT_ChangeSector() may free or reuse the nodes of the list,
+//  the things are copied onto a stack first and each processed once, as long as
+//  it is still touching the sector by then.
 //
 dboolean P_ChangeSector(sector_t *sector, dboolean crunch)
 {
-    msecnode_t  *n;
+    // keep any things pushed by an outer call to this function
+    const int   first = numchangesectorthings;
 
     nofit = false;
     crushchange = crunch;
 
-    // Mark all things invalid
-    for (n = sector->touching_thinglist; n; n = n->m_snext)
-        n->visited = false;
-
-    do
+    for (msecnode_t *n = sector->touching_thinglist; n; n = n->m_snext)
     {
-        for (n = sector->touching_thinglist; n; n = n->m_snext)     // go through list
-            if (!n->visited)                                        // unprocessed thing found
-            {
-                mobj_t  *mobj;
+        if (!n->m_thing)
+            continue;
 
-                n->visited = true;                                  // mark thing as processed
+        if (numchangesectorthings == maxchangesectorthings)
+        {
+            maxchangesectorthings = (maxchangesectorthings ? maxchangesectorthings * 2 : 128);
+            changesectorthings = I_Realloc(changesectorthings, maxchangesectorthings * sizeof(*changesectorthings));
+        }
 
-                if ((mobj = n->m_thing) && !(mobj->flags & MF_NOBLOCKMAP))
-                    PIT_ChangeSector(mobj);                         // process it
+        changesectorthings[numchangesectorthings++] = n->m_thing;
+    }
 
-                break;                                              // exit and start over
-            }
-    } while (n);    // repeat from scratch until all things left are marked valid
+    for (int i = first; i < numchangesectorthings; i++)
+    {
+        mobj_t  *mobj = changesectorthings[i];
+
+        // removed things have MF_NOBLOCKMAP set, but aren't freed until later
+        if (!(mobj->flags & MF_NOBLOCKMAP) && P_ThingTouchesSector(mobj, sector))
+            PIT_ChangeSector(mobj);
+    }
+
+    numchangesectorthings = first;
 
     return nofit;
 }
@@ -410,6 +410,9 @@ dboolean P_BlockThingsIterator(int x, int y, dboolean func(mobj_t *))
 static intercept_t  *intercepts;
 static intercept_t  *intercept_p;
 
+// false if intercepts are traversed by P_ScanIntercepts()
+dboolean            sortintercepts = true;
+
 // Check for limit and double size if necessary -- killough
 void P_CheckIntercepts(void)
 {
@@ -565,11 +568,11 @@ static dboolean PIT_AddThingIntercepts(mobj_t *thing)
 }
 
 //
-// P_TraverseIntercepts
-// Returns true if the traverser function returns true
-// for all lines.
+// P_ScanIntercepts
+// The original way of traversing intercepts, by scanning all of them
+//  for the nearest one each step. Used with the -scanintercepts parameter.
 //
-static dboolean P_TraverseIntercepts(traverser_t func, fixed_t maxfrac)
+static dboolean P_ScanIntercepts(traverser_t func, fixed_t maxfrac)
 {
     size_t      count = intercept_p - intercepts;
     intercept_t *in = NULL;
@@ -597,6 +600,69 @@ static dboolean P_TraverseIntercepts(traverser_t func, fixed_t maxfrac)
     return true;                // everything was traversed
 }
 
+static int P_CompareInterceptKeys(const void *a, const void *b)
+{
+    const uint64_t  key1 = *(const uint64_t *)a;
+    const uint64_t  key2 = *(const uint64_t *)b;
+
+    return (key1 > key2) - (key1 < key2);
+}
+
+//
+// P_TraverseIntercepts
+// Returns true if the traverser function returns true
+// for all lines.
+//
+// The intercepts are sorted once by a key of their frac and then their
+//  index, so ties are traversed in the same order as P_ScanIntercepts().
+//
+static dboolean P_TraverseIntercepts(traverser_t func, fixed_t maxfrac)
+{
+    static uint64_t *keys;
+    static size_t   num_keys;
+    const size_t    count = intercept_p - intercepts;
+
+    if (!sortintercepts)
+        return P_ScanIntercepts(func, maxfrac);
+
+    if (count > num_keys)
+    {
+        num_keys = MAX(count, num_keys * 2);
+        keys = I_Realloc(keys, sizeof(*keys) * num_keys);
+    }
+
+    // flip the sign bit so negative fracs sort first
+    for (size_t i = 0; i < count; i++)
+        keys[i] = ((uint64_t)((uint32_t)intercepts[i].frac ^ 0x80000000) << 32) | i;
+
+    if (count < 16)
+        for (size_t i = 1; i < count; i++)
+        {
+            const uint64_t  temp = keys[i];
+            size_t          j = i;
+
+            for (; j && keys[j - 1] > temp; j--)
+                keys[j] = keys[j - 1];
+
+            keys[j] = temp;
+        }
+    else
+        qsort(keys, count, sizeof(*keys), P_CompareInterceptKeys);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        intercept_t *in = &intercepts[(uint32_t)keys[i]];
+
+        if (in->frac > maxfrac || in->frac == FIXED_MAX)
+            return true;        // checked everything in range
+
+        if (!func(in))
+            return false;       // don't bother going farther
+    }
+
+    return true;                // everything was traversed
+}
+
 //
 // P_PathTraverse
 // Traces a line from (x1,y1) to (x2,y2),
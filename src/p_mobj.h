@@ -426,6 +426,10 @@ typedef struct mobj_s
     fixed_t             oldx, oldy, oldz;
     angle_t             oldangle;
 
+    // Position of mobj interpolated once a frame
+    //      by R_InterpolateFrame() for the renderer.
+    fixed_t             interpx, interpy, interpz;
+
     fixed_t             nudge;
 
     int                 pitch;
@@ -44,6 +44,7 @@
 #include "doomstat.h"
 #include "i_swap.h"
 #include "i_system.h"
+#include "i_timer.h"
 #include "m_argv.h"
 #include "m_bbox.h"
 #include "m_config.h"
@@ -188,6 +189,17 @@ dboolean            skipblstart;            // MaxW: Skip initial blocklist shor
 static int          rejectlump = -1;        // cph - store reject lump num if cached
 const byte          *rejectmatrix;          // cph - const*
 
+// PVS
+// The subsectors and nodes that might be seen from each sector, and the sectors
+//  that might see each other, worked out when a map is loaded.
+//
+byte                *pvsmatrix;             // sector-to-sector, for sight checks
+byte                *pvsrows;               // compressed rows of subsectors and nodes
+static int          *pvsrowoffsets;
+static int          pvsrowsize;
+static byte         *pvsrow;                // decompressed row of the last sector looked up
+static int          pvsrowsector;
+
 static mapinfo_t    mapinfo[101];
 
 static char *mapcmdnames[] =
@@ -237,6 +249,7 @@ static int      RMAPINFO;
 static int      MAPINFO;
 
 dboolean        r_fixmaperrors = r_fixmaperrors_default;
+dboolean        r_pvs = r_pvs_default;
 
 static dboolean samelevel;
 
@@ -2114,6 +2127,423 @@ static void P_LoadReject(int lumpnum)
     RejectOverrun(rejectlump, &rejectmatrix);
 }
 
+//
+// P_BuildPVS
+// Works out a potentially visible set for each sector. Every two-sided line is
+//  an opening, however high its sectors are now, so doors and lifts that open
+//  later are allowed for. A line of sight that passes through an opening never
+//  crosses back behind it, so from each opening out of a sector, only the
+//  openings with some part in front of it, and that it has some part behind,
+//  are followed. The subsectors and nodes found are stored a row per sector,
+//  with runs of zero bytes run-length encoded, and the sectors found are stored
+//  in a sector-to-sector matrix for sight checks.
+//
+// A line with the same sector on both sides doesn't block sight. It is an opening
+//  between the sectors of the subsectors its segs are in, since a self-referencing
+//  sector can have subsectors in the area of another sector. Any self-referencing
+//  sector that does, or that has no openings at all, is always visible and sees
+//  everything.
+//
+#define PVSEPSILON  1.0
+
+typedef struct
+{
+    double      x, y;
+    double      dx, dy;     // unit length, with the sector it leads to on the left
+    double      length;
+    line_t      *line;
+    int         from;
+    int         to;
+} pvsportal_t;
+
+typedef struct
+{
+    int         line;
+    int         side;
+    int         sector;
+} pvsseg_t;
+
+static double P_PVSDistance(const pvsportal_t *portal, const double x, const double y)
+{
+    return (portal->dx * (y - portal->y) - portal->dy * (x - portal->x));
+}
+
+static dboolean P_PVSPortalInFront(const pvsportal_t *portal, const pvsportal_t *source)
+{
+    return (P_PVSDistance(source, portal->x, portal->y) >= -PVSEPSILON
+        || P_PVSDistance(source, portal->x + portal->dx * portal->length,
+            portal->y + portal->dy * portal->length) >= -PVSEPSILON);
+}
+
+static dboolean P_PVSBoxInFront(const double *box, const pvsportal_t *portal)
+{
+    return (P_PVSDistance(portal, box[BOXLEFT], box[BOXTOP]) >= -PVSEPSILON
+        || P_PVSDistance(portal, box[BOXRIGHT], box[BOXTOP]) >= -PVSEPSILON
+        || P_PVSDistance(portal, box[BOXLEFT], box[BOXBOTTOM]) >= -PVSEPSILON
+        || P_PVSDistance(portal, box[BOXRIGHT], box[BOXBOTTOM]) >= -PVSEPSILON);
+}
+
+static dboolean P_MarkPVSNode(byte *row, const int bspnum)
+{
+    if (bspnum & NF_SUBSECTOR)
+    {
+        const int   num = (bspnum == -1 ? 0 : (bspnum & ~NF_SUBSECTOR));
+
+        return !!(row[num >> 3] & (1 << (num & 7)));
+    }
+    else
+    {
+        const int       bit = numsubsectors + bspnum;
+        const dboolean  visible = (P_MarkPVSNode(row, nodes[bspnum].children[0])
+                            | P_MarkPVSNode(row, nodes[bspnum].children[1]));
+
+        if (visible)
+            row[bit >> 3] |= 1 << (bit & 7);
+
+        return visible;
+    }
+}
+
+// Add an opening through a line from a sector on its front side to one on its back
+//  side, and the other way.
+static void P_AddPVSPortals(pvsportal_t **portals, int *numportals, int *maxportals,
+    line_t *line, const int front, const int back)
+{
+    const double    x1 = FIXED2DOUBLE(line->v1->x);
+    const double    y1 = FIXED2DOUBLE(line->v1->y);
+    const double    x2 = FIXED2DOUBLE(line->v2->x);
+    const double    y2 = FIXED2DOUBLE(line->v2->y);
+    const double    length = sqrt((x2 - x1) * (x2 - x1) + (y2 - y1) * (y2 - y1));
+
+    if (!length)
+        return;
+
+    if (*numportals + 2 > *maxportals)
+        *portals = I_Realloc(*portals, (*maxportals = MAX(*maxportals * 2, *numportals + 2)) * sizeof(**portals));
+
+    (*portals)[(*numportals)++] = (pvsportal_t){ x1, y1, (x2 - x1) / length, (y2 - y1) / length, length,
+        line, front, back };
+    (*portals)[(*numportals)++] = (pvsportal_t){ x2, y2, (x1 - x2) / length, (y1 - y2) / length, length,
+        line, back, front };
+}
+
+static int P_ComparePVSSegs(const void *a, const void *b)
+{
+    const pvsseg_t  *seg1 = a;
+    const pvsseg_t  *seg2 = b;
+
+    return (seg1->line != seg2->line ? seg1->line - seg2->line :
+        (seg1->side != seg2->side ? seg1->side - seg2->side : seg1->sector - seg2->sector));
+}
+
+void P_BuildPVS(void)
+{
+    const uint64_t  starttime = I_GetTimeNS();
+    int             maxportals = numlines * 2;
+    pvsportal_t     *portals = malloc(maxportals * sizeof(*portals));
+    int             *firstportal = calloc((size_t)numsectors + 1, sizeof(*firstportal));
+    int             *sectorportals;
+    int             *firstsubsector = calloc((size_t)numsectors + 1, sizeof(*firstsubsector));
+    int             *sectorsubsectors = malloc(numsubsectors * sizeof(*sectorsubsectors));
+    double          (*boxes)[4] = malloc(numsubsectors * sizeof(*boxes));
+    pvsseg_t        *pvssegs = malloc(numsegs * sizeof(*pvssegs));
+    dboolean        *selfreferencing = calloc(numsectors, sizeof(*selfreferencing));
+    dboolean        *alwaysvisible = calloc(numsectors, sizeof(*alwaysvisible));
+    int             *queue;
+    int             *stamps = calloc(numsectors, sizeof(*stamps));
+    byte            *compressed = NULL;
+    byte            *row;
+    int             numportals = 0;
+    int             numpvssegs = 0;
+    int             compressedsize = 0;
+    int             capacity = 0;
+    int             stamp = 0;
+    int64_t         visible = 0;
+    int             size;
+
+    pvsrowsize = (numsubsectors + numnodes + 7) / 8;
+    pvsrowsector = -1;
+    pvsmatrix = Z_Calloc(1, ((size_t)numsectors * numsectors + 7) / 8, PU_LEVEL, NULL);
+    pvsrowoffsets = Z_Malloc(numsectors * sizeof(*pvsrowoffsets), PU_LEVEL, NULL);
+    pvsrow = Z_Malloc(pvsrowsize, PU_LEVEL, NULL);
+    row = malloc(pvsrowsize);
+
+    // gather the openings between different sectors
+    for (int i = 0; i < numlines; i++)
+    {
+        line_t  *line = lines + i;
+
+        if (!line->backsector)
+            continue;
+
+        if (line->backsector == line->frontsector)
+            selfreferencing[line->frontsector->id] = true;
+        else
+            P_AddPVSPortals(&portals, &numportals, &maxportals, line, line->frontsector->id, line->backsector->id);
+    }
+
+    // find the sectors of the subsectors on each side of the self-referencing lines
+    for (int i = 0; i < numsubsectors; i++)
+    {
+        seg_t   *seg = segs + subsectors[i].firstline;
+
+        for (int j = 0; j < subsectors[i].numlines; j++, seg++)
+        {
+            line_t  *line = seg->linedef;
+
+            if (line && line->backsector && line->backsector == line->frontsector)
+                pvssegs[numpvssegs++] = (pvsseg_t){ (int)(line - lines),
+                    ((double)seg->dx * line->dx + (double)seg->dy * line->dy < 0.0), subsectors[i].sector->id };
+        }
+    }
+
+    qsort(pvssegs, numpvssegs, sizeof(*pvssegs), P_ComparePVSSegs);
+
+    for (int i = 0, j; i < numpvssegs; i = j)
+    {
+        line_t      *line = lines + pvssegs[i].line;
+        const int   id = line->frontsector->id;
+        int         back = i;
+
+        for (j = i; j < numpvssegs && pvssegs[j].line == pvssegs[i].line; j++)
+            if (pvssegs[j].sector != id)
+                alwaysvisible[id] = true;
+
+        // join each sector on the front side to each different one on the back side
+        while (back < j && !pvssegs[back].side)
+            back++;
+
+        for (int k = i; k < back; k++)
+            if (k == i || pvssegs[k].sector != pvssegs[k - 1].sector)
+                for (int l = back; l < j; l++)
+                    if ((l == back || pvssegs[l].sector != pvssegs[l - 1].sector)
+                        && pvssegs[k].sector != pvssegs[l].sector)
+                        P_AddPVSPortals(&portals, &numportals, &maxportals, line, pvssegs[k].sector, pvssegs[l].sector);
+    }
+
+    sectorportals = malloc(MAX(1, numportals) * sizeof(*sectorportals));
+    queue = malloc(MAX(1, numportals) * sizeof(*queue));
+
+    // list the openings out of each sector, and the subsectors in each sector
+    for (int i = 0; i < numportals; i++)
+        firstportal[portals[i].from + 1]++;
+
+    for (int i = 0; i < numsubsectors; i++)
+        firstsubsector[subsectors[i].sector->id + 1]++;
+
+    for (int i = 0; i < numsectors; i++)
+    {
+        firstportal[i + 1] += firstportal[i];
+        firstsubsector[i + 1] += firstsubsector[i];
+
+        // a self-referencing sector that can't be reached can't be culled
+        if (selfreferencing[i] && firstportal[i + 1] == firstportal[i])
+            alwaysvisible[i] = true;
+    }
+
+    for (int i = 0; i < numportals; i++)
+        sectorportals[firstportal[portals[i].from] + stamps[portals[i].from]++] = i;
+
+    memset(stamps, 0, numsectors * sizeof(*stamps));
+
+    for (int i = 0; i < numsubsectors; i++)
+    {
+        const int   id = subsectors[i].sector->id;
+        seg_t       *seg = segs + subsectors[i].firstline;
+        double      *box = boxes[i];
+
+        sectorsubsectors[firstsubsector[id] + stamps[id]++] = i;
+
+        box[BOXLEFT] = box[BOXRIGHT] = FIXED2DOUBLE(seg->v1->x);
+        box[BOXBOTTOM] = box[BOXTOP] = FIXED2DOUBLE(seg->v1->y);
+
+        for (int j = 0; j < subsectors[i].numlines; j++, seg++)
+        {
+            box[BOXLEFT] = MIN(box[BOXLEFT], MIN(FIXED2DOUBLE(seg->v1->x), FIXED2DOUBLE(seg->v2->x)));
+            box[BOXRIGHT] = MAX(box[BOXRIGHT], MAX(FIXED2DOUBLE(seg->v1->x), FIXED2DOUBLE(seg->v2->x)));
+            box[BOXBOTTOM] = MIN(box[BOXBOTTOM], MIN(FIXED2DOUBLE(seg->v1->y), FIXED2DOUBLE(seg->v2->y)));
+            box[BOXTOP] = MAX(box[BOXTOP], MAX(FIXED2DOUBLE(seg->v1->y), FIXED2DOUBLE(seg->v2->y)));
+        }
+    }
+
+    memset(stamps, 0, numsectors * sizeof(*stamps));
+
+    for (int i = 0; i < numsectors; i++)
+    {
+        int count = 0;
+
+        if (alwaysvisible[i])
+        {
+            // everything might be seen
+            memset(row, 0xFF, pvsrowsize);
+
+            for (int j = 0; j < numsectors; j++)
+            {
+                const size_t    pnum = (size_t)i * numsectors + j;
+
+                pvsmatrix[pnum >> 3] |= 1 << (pnum & 7);
+            }
+        }
+        else
+        {
+            memset(row, 0, pvsrowsize);
+
+            // everything in the sector itself might be seen
+            for (int j = firstsubsector[i]; j < firstsubsector[i + 1]; j++)
+                row[sectorsubsectors[j] >> 3] |= 1 << (sectorsubsectors[j] & 7);
+
+            // flood out through each opening in turn
+            for (int j = firstportal[i]; j < firstportal[i + 1]; j++)
+            {
+                const pvsportal_t   *source = portals + sectorportals[j];
+                int                 head = 0;
+                int                 tail = 0;
+
+                queue[tail++] = sectorportals[j];
+                stamp++;
+
+                while (head < tail)
+                {
+                    const pvsportal_t   *portal = portals + queue[head++];
+                    const int           to = portal->to;
+                    const size_t        pnum = (size_t)i * numsectors + to;
+
+                    pvsmatrix[pnum >> 3] |= 1 << (pnum & 7);
+
+                    for (int k = firstsubsector[to]; k < firstsubsector[to + 1]; k++)
+                    {
+                        const int   num = sectorsubsectors[k];
+
+                        if (P_PVSBoxInFront(boxes[num], source) && P_PVSBoxInFront(boxes[num], portal))
+                            row[num >> 3] |= 1 << (num & 7);
+                    }
+
+                    if (stamps[to] == stamp)
+                        continue;
+
+                    stamps[to] = stamp;
+
+                    for (int k = firstportal[to]; k < firstportal[to + 1]; k++)
+                    {
+                        const pvsportal_t   *next = portals + sectorportals[k];
+
+                        if (next->line != source->line
+                            && P_PVSPortalInFront(next, source)
+                            && (P_PVSDistance(next, source->x, source->y) <= PVSEPSILON
+                                || P_PVSDistance(next, source->x + source->dx * source->length,
+                                    source->y + source->dy * source->length) <= PVSEPSILON))
+                            queue[tail++] = sectorportals[k];
+                    }
+                }
+            }
+
+            // sectors that are always visible, and what is in them
+            for (int j = 0; j < numsectors; j++)
+                if (alwaysvisible[j] || j == i)
+                {
+                    const size_t    pnum = (size_t)i * numsectors + j;
+
+                    pvsmatrix[pnum >> 3] |= 1 << (pnum & 7);
+
+                    for (int k = firstsubsector[j]; k < firstsubsector[j + 1]; k++)
+                        row[sectorsubsectors[k] >> 3] |= 1 << (sectorsubsectors[k] & 7);
+                }
+
+            P_MarkPVSNode(row, numnodes - 1);
+        }
+
+        for (int j = 0; j < numsubsectors; j++)
+            if (row[j >> 3] & (1 << (j & 7)))
+                count++;
+
+        visible += (int64_t)count * (firstsubsector[i + 1] - firstsubsector[i]);
+
+        // compress the row, replacing each run of zero bytes with a zero and its length
+        if (compressedsize + pvsrowsize * 2 > capacity)
+            compressed = I_Realloc(compressed, (capacity = MAX(capacity * 2, compressedsize + pvsrowsize * 2)));
+
+        pvsrowoffsets[i] = compressedsize;
+
+        for (int j = 0; j < pvsrowsize; j++)
+            if (row[j])
+                compressed[compressedsize++] = row[j];
+            else
+            {
+                int run = 1;
+
+                while (j + 1 < pvsrowsize && !row[j + 1] && run < 255)
+                {
+                    j++;
+                    run++;
+                }
+
+                compressed[compressedsize++] = 0;
+                compressed[compressedsize++] = run;
+            }
+    }
+
+    // the sectors that are always visible can be seen from every sector
+    for (int i = 0; i < numsectors; i++)
+        if (alwaysvisible[i])
+            for (int j = 0; j < numsectors; j++)
+            {
+                const size_t    pnum = (size_t)j * numsectors + i;
+
+                pvsmatrix[pnum >> 3] |= 1 << (pnum & 7);
+            }
+
+    pvsrows = Z_Malloc(MAX(1, compressedsize), PU_LEVEL, NULL);
+    memcpy(pvsrows, compressed, compressedsize);
+
+    free(compressed);
+    free(row);
+    free(stamps);
+    free(queue);
+    free(alwaysvisible);
+    free(selfreferencing);
+    free(pvssegs);
+    free(boxes);
+    free(sectorsubsectors);
+    free(firstsubsector);
+    free(sectorportals);
+    free(firstportal);
+    free(portals);
+
+    size = compressedsize + numsectors * (int)sizeof(*pvsrowoffsets) + (numsectors * numsectors + 7) / 8 + pvsrowsize;
+
+    C_Output("Built a PVS in %s milliseconds. It uses %s KB, and %i%% of the map is potentially visible from each "
+        "subsector on average.", commify((I_GetTimeNS() - starttime) / 1000000), commify(MAX(1, size / 1024)),
+        (int)(visible * 100 / MAX(1, (int64_t)numsubsectors * numsubsectors)));
+}
+
+//
+// P_GetPVS
+// Returns the decompressed row of subsectors and nodes that might be seen from a sector.
+//
+const byte *P_GetPVS(const int sector)
+{
+    if (sector != pvsrowsector)
+    {
+        const byte  *in = pvsrows + pvsrowoffsets[sector];
+        byte        *out = pvsrow;
+        const byte  *end = pvsrow + pvsrowsize;
+
+        while (out < end)
+            if (*in)
+                *out++ = *in++;
+            else
+            {
+                memset(out, 0, in[1]);
+                out += in[1];
+                in += 2;
+            }
+
+        pvsrowsector = sector;
+    }
+
+    return pvsrow;
+}
+
 //
 // P_GroupLines
 // Builds sector line lists and subsector sector numbers.
@@ -2556,6 +2986,9 @@ void P_SetupLevel(int ep, int map)
         rejectlump = -1;
     }
 
+    pvsmatrix = NULL;
+    pvsrows = NULL;
+
     P_InitThinkers();
 
     // find map name
@@ -2660,6 +3093,9 @@ void P_SetupLevel(int ep, int map)
 
     P_CalcSegsLength();
 
+    if (r_pvs)
+        P_BuildPVS();
+
     r_bloodsplats_total = 0;
 
     markpointnum = 0;
@@ -43,6 +43,8 @@ extern dboolean canmodify;
 extern dboolean skipblstart;    // MaxW: Skip initial blocklist short
 
 void P_SetupLevel(int ep, int map);
+void P_BuildPVS(void);
+const byte *P_GetPVS(const int sector);
 void P_MapName(int ep, int map);
 
 // Called by startup code.
@@ -36,7 +36,9 @@
 ========================================================================
 */
 
+#include "doomstat.h"
 #include "m_bbox.h"
+#include "m_config.h"
 #include "p_local.h"
 
 //
@@ -222,6 +224,10 @@ dboolean P_CheckSight(mobj_t *t1, mobj_t *t2)
     if (rejectmatrix[pnum >> 3] & (1 << (pnum & 7)))
         return false;
 
+    // Check in the PVS, if one was built for this map.
+    if (r_pvs && pvsmatrix && !(pvsmatrix[pnum >> 3] & (1 << (pnum & 7))))
+        return false;
+
     // killough 4/19/98: make fake floors and ceilings block monster view
     if ((s1->heightsec
         && ((t1->z + t1->height <= s1->heightsec->interpfloorheight
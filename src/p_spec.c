@@ -74,6 +74,7 @@ typedef struct
     int             basepic;
     int             numpics;
     int             speed;
+    int             nexttic;
 } anim_t;
 
 #if defined(_MSC_VER) || defined(__GNUC__)
@@ -99,6 +100,8 @@ typedef struct
 
 unsigned int        stat_secretsrevealed = 0;
 
+int                 r_animupdates;
+
 dboolean            r_liquid_bob = r_liquid_bob_default;
 
 fixed_t             animatedliquiddiff;
@@ -2300,10 +2303,22 @@ void P_UpdateSpecials(void)
             G_ExitLevel();
 
     // ANIMATE FLATS AND TEXTURES GLOBALLY
+    // only touch an anim's translations on the tic its frame changes
+    r_animupdates = 0;
+
     for (anim_t *anim = anims; anim < lastanim; anim++)
+    {
+        int frame;
+
+        if (leveltime < anim->nexttic)
+            continue;
+
+        frame = leveltime / anim->speed;
+        anim->nexttic = (frame + 1) * anim->speed;
+
         for (int i = anim->basepic; i < anim->basepic + anim->numpics; i++)
         {
-            int pic = anim->basepic + ((leveltime / anim->speed + i) % anim->numpics);
+            int pic = anim->basepic + ((frame + i) % anim->numpics);
 
             if (anim->istexture)
                 texturetranslation[i] = pic;
@@ -2311,6 +2326,9 @@ void P_UpdateSpecials(void)
                 flattranslation[i] = firstflat + pic;
         }
 
+        r_animupdates += anim->numpics;
+    }
+
     animatedliquiddiff += animatedliquiddiffs[leveltime & 63];
     animatedliquidxoffs += animatedliquidxdir;
 
@@ -2325,60 +2343,64 @@ void P_UpdateSpecials(void)
     skycolumnoffset += skyscrolldelta;
 
     // DO BUTTONS
-    for (int i = 0; i < maxbuttons; i++)
-        if (buttonlist[i].btimer)
-            if (!--buttonlist[i].btimer)
+    // active buttons are kept at the front of buttonlist, so walk only those. Walk backwards so
+    //  a button moved into an expired button's slot has already been counted down this tic.
+    for (int i = numbuttons - 1; i >= 0; i--)
+        if (!--buttonlist[i].btimer)
+        {
+            line_t      *line = buttonlist[i].line;
+            sector_t    *sector = line->backsector;
+            int         sidenum = line->sidenum[0];
+            short       toptexture = sides[sidenum].toptexture;
+            short       midtexture = sides[sidenum].midtexture;
+            short       bottomtexture = sides[sidenum].bottomtexture;
+            int         btexture = buttonlist[i].btexture;
+
+            switch (buttonlist[i].where)
             {
-                line_t      *line = buttonlist[i].line;
-                sector_t    *sector = line->backsector;
-                int         sidenum = line->sidenum[0];
-                short       toptexture = sides[sidenum].toptexture;
-                short       midtexture = sides[sidenum].midtexture;
-                short       bottomtexture = sides[sidenum].bottomtexture;
-                int         btexture = buttonlist[i].btexture;
-
-                switch (buttonlist[i].where)
-                {
-                    case top:
-                        sides[sidenum].toptexture = btexture;
-
-                        if (midtexture == toptexture)
-                            sides[sidenum].midtexture = btexture;
-
-                        if (bottomtexture == toptexture)
-                            sides[sidenum].bottomtexture = btexture;
+                case top:
+                    sides[sidenum].toptexture = btexture;
 
-                        break;
-
-                    case middle:
+                    if (midtexture == toptexture)
                         sides[sidenum].midtexture = btexture;
 
-                        if (toptexture == midtexture)
-                            sides[sidenum].toptexture = btexture;
+                    if (bottomtexture == toptexture)
+                        sides[sidenum].bottomtexture = btexture;
 
-                        if (bottomtexture == midtexture)
-                            sides[sidenum].bottomtexture = btexture;
+                    break;
 
-                        break;
+                case middle:
+                    sides[sidenum].midtexture = btexture;
+
+                    if (toptexture == midtexture)
+                        sides[sidenum].toptexture = btexture;
 
-                    case bottom:
+                    if (bottomtexture == midtexture)
                         sides[sidenum].bottomtexture = btexture;
 
-                        if (toptexture == bottomtexture)
-                            sides[sidenum].toptexture = btexture;
+                    break;
 
-                        if (midtexture == bottomtexture)
-                            sides[sidenum].midtexture = btexture;
+                case bottom:
+                    sides[sidenum].bottomtexture = btexture;
 
-                        break;
+                    if (toptexture == bottomtexture)
+                        sides[sidenum].toptexture = btexture;
 
-                    case nowhere:
-                        break;
-                }
+                    if (midtexture == bottomtexture)
+                        sides[sidenum].midtexture = btexture;
 
-                if (!sector || (!sector->floordata && !sector->ceilingdata) || line->tag != sector->tag)
-                    S_StartSectorSound(buttonlist[i].soundorg, sfx_swtchn);
+                    break;
+
+                case nowhere:
+                    break;
             }
+
+            if (!sector || (!sector->floordata && !sector->ceilingdata) || line->tag != sector->tag)
+                S_StartSectorSound(buttonlist[i].soundorg, sfx_swtchn);
+
+            buttonlist[i] = buttonlist[--numbuttons];
+            memset(&buttonlist[numbuttons], 0, sizeof(button_t));
+        }
 }
 
 //
@@ -2546,8 +2568,11 @@ void P_SpawnSpecials(void)
     P_RemoveAllActiveCeilings();        // jff 2/22/98 use killough's scheme
     P_RemoveAllActivePlats();           // killough
 
-    for (int i = 0; i < maxbuttons; i++)
-        memset(&buttonlist[i], 0, sizeof(button_t));
+    memset(buttonlist, 0, sizeof(*buttonlist) * maxbuttons);
+    numbuttons = 0;
+
+    for (anim_t *anim = anims; anim < lastanim; anim++)
+        anim->nexttic = 0;
 
     // P_InitTagLists() must be called before P_FindSectorFromLineTag()
     // or P_FindLineFromLineTag() can be called.
@@ -241,6 +241,7 @@ typedef struct
 
 extern button_t *buttonlist;
 extern int      maxbuttons;
+extern int      numbuttons;
 
 void P_InitSwitchList(void);
 void P_StartButton(line_t *line, bwhere_e where, int texture, int time);
@@ -54,6 +54,7 @@ static int          numswitches;        // killough
 
 button_t            *buttonlist = NULL;
 int                 maxbuttons = MAXBUTTONS;
+int                 numbuttons;
 
 extern texture_t    **textures;
 extern dboolean     autousing;
@@ -143,26 +144,25 @@ void P_InitSwitchList(void)
 void P_StartButton(line_t *line, bwhere_e where, int texture, int time)
 {
     // See if button is already pressed
-    for (int i = 0; i < maxbuttons; i++)
-        if (buttonlist[i].btimer && buttonlist[i].line == line)
+    for (int i = 0; i < numbuttons; i++)
+        if (buttonlist[i].line == line)
             return;
 
-    for (int i = 0; i < maxbuttons; i++)
-        if (!buttonlist[i].btimer)
-        {
-            buttonlist[i].line = line;
-            buttonlist[i].where = where;
-            buttonlist[i].btexture = texture;
-            buttonlist[i].btimer = time;
-            buttonlist[i].soundorg = &line->soundorg;
-            return;
-        }
-
     // [crispy] remove MAXBUTTONS limit
-    maxbuttons *= 2;
-    buttonlist = I_Realloc(buttonlist, sizeof(*buttonlist) * maxbuttons);
-    memset(buttonlist + maxbuttons / 2, 0, sizeof(*buttonlist) * ((size_t)maxbuttons - maxbuttons / 2));
-    P_StartButton(line, where, texture, time);
+    if (numbuttons == maxbuttons)
+    {
+        maxbuttons *= 2;
+        buttonlist = I_Realloc(buttonlist, sizeof(*buttonlist) * maxbuttons);
+        memset(buttonlist + numbuttons, 0, sizeof(*buttonlist) * ((size_t)maxbuttons - numbuttons));
+    }
+
+    // active buttons are kept packed at the front of buttonlist
+    buttonlist[numbuttons].line = line;
+    buttonlist[numbuttons].where = where;
+    buttonlist[numbuttons].btexture = texture;
+    buttonlist[numbuttons].btimer = time;
+    buttonlist[numbuttons].soundorg = &line->soundorg;
+    numbuttons++;
 }
 
 //
@@ -38,6 +38,7 @@
 
 #include "c_console.h"
 #include "doomstat.h"
+#include "i_timer.h"
 #include "p_local.h"
 #include "p_tick.h"
 #include "s_sound.h"
@@ -234,7 +235,9 @@ void P_Ticker(void)
         return;
     }
 
+    PROFILE_START(PROFILE_P_RUNTHINKERS);
     P_RunThinkers();
+    PROFILE_END(PROFILE_P_RUNTHINKERS);
 
     P_UpdateSpecials();
     P_RespawnSpecials();
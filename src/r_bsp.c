@@ -41,9 +41,11 @@
 
 #include "doomstat.h"
 #include "m_bbox.h"
+#include "m_config.h"
 #include "r_main.h"
 #include "r_plane.h"
 #include "r_things.h"
+#include "z_zone.h"
 
 seg_t       *curline;
 line_t      *linedef;
@@ -69,6 +71,19 @@ void R_ClearDrawSegs(void)
 static int  memcmpsize;
 byte        *solidcol;
 
+// The leftmost and rightmost columns that aren't solid yet. Every column outside
+// them is solid, so a range can often be found to be hidden without searching solidcol[],
+// and the whole view is solid once they cross.
+static int  firstopencol;
+static int  lastopencol;
+
+dboolean    r_occlusion = r_occlusion_default;
+
+// The subsectors and nodes that might be seen from the view's sector, or NULL.
+const byte  *pvs;
+
+#define PVSVISIBLE(i)   (pvs[(i) >> 3] & (1 << ((i) & 7)))
+
 // CPhipps -
 // R_ClipWallSegment
 //
@@ -76,6 +91,12 @@ byte        *solidcol;
 // columns which aren't solid, and updates the solidcol[] array appropriately
 static void R_ClipWallSegment(int first, int last, dboolean solid)
 {
+    if (r_occlusion)
+    {
+        first = MAX(first, firstopencol);
+        last = MIN(last, lastopencol + 1);
+    }
+
     while (first < last)
         if (solidcol[first])
         {
@@ -98,6 +119,12 @@ static void R_ClipWallSegment(int first, int last, dboolean solid)
 
             first = to;
         }
+
+    while (firstopencol <= lastopencol && solidcol[firstopencol])
+        firstopencol++;
+
+    while (lastopencol >= firstopencol && solidcol[lastopencol])
+        lastopencol--;
 }
 
 //
@@ -119,6 +146,8 @@ void R_InitClipSegs(void)
 void R_ClearClipSegs(void)
 {
     memset(solidcol, 0, SCREENWIDTH);
+    firstopencol = 0;
+    lastopencol = viewwidth - 1;
 }
 
 // killough 1/18/98 -- This function is used to fix the automap bug which
@@ -181,56 +210,6 @@ static void R_RecalcLineFlags(line_t *line)
     }
 }
 
-// [AM] Interpolate the passed sector, if prudent.
-static void R_MaybeInterpolateSector(sector_t *sector)
-{
-    sector_t    *heightsec = sector->heightsec;
-
-    if (vid_capfps != TICRATE
-        // Only if we moved the sector last tic.
-        && sector->oldgametime == gametime - 1)
-    {
-        // Interpolate between current and last floor/ceiling position.
-        if (sector->floorheight != sector->oldfloorheight)
-            sector->interpfloorheight = sector->oldfloorheight
-                + FixedMul(sector->floorheight - sector->oldfloorheight, fractionaltic);
-        else
-            sector->interpfloorheight = sector->floorheight;
-
-        if (sector->ceilingheight != sector->oldceilingheight)
-            sector->interpceilingheight = sector->oldceilingheight
-                + FixedMul(sector->ceilingheight - sector->oldceilingheight, fractionaltic);
-        else
-            sector->interpceilingheight = sector->ceilingheight;
-
-        if (heightsec)
-        {
-            if (heightsec->floorheight != heightsec->oldfloorheight)
-                heightsec->interpfloorheight = heightsec->oldfloorheight
-                    + FixedMul(heightsec->floorheight - heightsec->oldfloorheight, fractionaltic);
-            else
-                heightsec->interpfloorheight = heightsec->floorheight;
-
-            if (heightsec->ceilingheight != heightsec->oldceilingheight)
-                heightsec->interpceilingheight = heightsec->oldceilingheight
-                    + FixedMul(heightsec->ceilingheight - heightsec->oldceilingheight, fractionaltic);
-            else
-                heightsec->interpceilingheight = heightsec->ceilingheight;
-        }
-    }
-    else
-    {
-        sector->interpfloorheight = sector->floorheight;
-        sector->interpceilingheight = sector->ceilingheight;
-
-        if (heightsec)
-        {
-            heightsec->interpfloorheight = heightsec->floorheight;
-            heightsec->interpceilingheight = heightsec->ceilingheight;
-        }
-    }
-}
-
 //
 // killough 3/7/98: Hack floor/ceiling heights for deep water etc.
 //
@@ -399,11 +378,6 @@ static void R_AddLine(seg_t *line)
     {
         sector_t    tempsec;    // killough 3/8/98: ceiling/water hack
 
-        // [AM] Interpolate sector movement before
-        //      running clipping tests. Frontsector
-        //      should already be interpolated.
-        R_MaybeInterpolateSector(backsector);
-
         // killough 3/8/98, 4/4/98: hack for invisible ceilings/deep water
         backsector = R_FakeFlat(backsector, &tempsec, NULL, NULL, true);
     }
@@ -449,6 +423,10 @@ static dboolean R_CheckBBox(const fixed_t *bspcoord)
     int         sx1;
     int         sx2;
 
+    // the whole view is already solid
+    if (r_occlusion && firstopencol > lastopencol)
+        return false;
+
     // Find the corners of the box
     // that define the edges from current viewpoint.
     boxpos = (viewx <= bspcoord[BOXLEFT] ? 0 : (viewx < bspcoord[BOXRIGHT] ? 1 : 2))
@@ -497,6 +475,16 @@ static dboolean R_CheckBBox(const fixed_t *bspcoord)
     if (sx1 == sx2)
         return false;
 
+    // only the open columns need searching
+    if (r_occlusion)
+    {
+        sx1 = MAX(sx1, firstopencol);
+        sx2 = MIN(sx2, lastopencol + 1);
+
+        if (sx1 >= sx2)
+            return false;
+    }
+
     if (!memchr(solidcol + sx1, 0, (size_t)sx2 - sx1))
         return false;
 
@@ -512,40 +500,47 @@ static dboolean R_CheckBBox(const fixed_t *bspcoord)
 static void R_Subsector(int num)
 {
     subsector_t *sub = subsectors + num;
-    sector_t    tempsec;                                        // killough 3/7/98: deep water hack
     sector_t    *sector = sub->sector;
-    int         floorlightlevel;                                // killough 3/16/98: set floor lightlevel
-    int         ceilinglightlevel;                              // killough 4/11/98
     int         count = sub->numlines;
     seg_t       *line = segs + sub->firstline;
 
-    frontsector = sector;
-
-    // [AM] Interpolate sector movement. Usually only needed
-    //      when you're standing inside the sector.
-    R_MaybeInterpolateSector(frontsector);
-
-    // killough 3/8/98, 4/4/98: Deep water/fake ceiling effect
-    frontsector = R_FakeFlat(frontsector, &tempsec, &floorlightlevel, &ceilinglightlevel, false);
-
-    floorplane = (frontsector->interpfloorheight < viewz        // killough 3/7/98
-        || (frontsector->heightsec && frontsector->heightsec->ceilingpic == skyflatnum) ?
-        R_FindPlane(frontsector->interpfloorheight,
-            (frontsector->floorpic == skyflatnum                // killough 10/98
-                && (frontsector->sky & PL_SKYFLAT) ? frontsector->sky : frontsector->floorpic),
-            floorlightlevel,                                    // killough 3/16/98
-            frontsector->floor_xoffs,                           // killough 3/7/98
-            frontsector->floor_yoffs) : NULL);
-
-    ceilingplane = (frontsector->interpceilingheight > viewz
-        || frontsector->ceilingpic == skyflatnum
-        || (frontsector->heightsec && frontsector->heightsec->floorpic == skyflatnum) ?
-        R_FindPlane(frontsector->interpceilingheight,           // killough 3/8/98
-            (frontsector->ceilingpic == skyflatnum              // killough 10/98
-                && (frontsector->sky & PL_SKYFLAT) ? frontsector->sky : frontsector->ceilingpic),
-            ceilinglightlevel,                                  // killough 4/11/98
-            frontsector->ceiling_xoffs,                         // killough 3/7/98
-            frontsector->ceiling_yoffs) : NULL);
+    // Only work out the sector's planes the first time one of its subsectors is rendered
+    //  in a frame. Its other subsectors reuse them, along with its copy for deep water.
+    if (sector->rendervalidcount != validcount)
+    {
+        sector->rendervalidcount = validcount;
+
+        if (sector->heightsec && !sector->renderfakeflat)
+            sector->renderfakeflat = Z_Malloc(sizeof(sector_t), PU_LEVEL, NULL);
+
+        // killough 3/8/98, 4/4/98: Deep water/fake ceiling effect
+        frontsector = R_FakeFlat(sector, sector->renderfakeflat, &sector->renderfloorlightlevel,
+            &sector->renderceilinglightlevel, false);
+
+        sector->renderfloorplane = (frontsector->interpfloorheight < viewz          // killough 3/7/98
+            || (frontsector->heightsec && frontsector->heightsec->ceilingpic == skyflatnum) ?
+            R_FindPlane(frontsector->interpfloorheight,
+                (frontsector->floorpic == skyflatnum                                // killough 10/98
+                    && (frontsector->sky & PL_SKYFLAT) ? frontsector->sky : frontsector->floorpic),
+                sector->renderfloorlightlevel,                                      // killough 3/16/98
+                frontsector->floor_xoffs,                                           // killough 3/7/98
+                frontsector->floor_yoffs) : NULL);
+
+        sector->renderceilingplane = (frontsector->interpceilingheight > viewz
+            || frontsector->ceilingpic == skyflatnum
+            || (frontsector->heightsec && frontsector->heightsec->floorpic == skyflatnum) ?
+            R_FindPlane(frontsector->interpceilingheight,                           // killough 3/8/98
+                (frontsector->ceilingpic == skyflatnum                              // killough 10/98
+                    && (frontsector->sky & PL_SKYFLAT) ? frontsector->sky : frontsector->ceilingpic),
+                sector->renderceilinglightlevel,                                    // killough 4/11/98
+                frontsector->ceiling_xoffs,                                         // killough 3/7/98
+                frontsector->ceiling_yoffs) : NULL);
+    }
+    else
+        frontsector = (sector->heightsec ? sector->renderfakeflat : sector);
+
+    floorplane = sector->renderfloorplane;
+    ceilingplane = sector->renderceilingplane;
 
     // killough 9/18/98: Fix underwater slowdown, by passing real sector
     // instead of fake one. Improve sprite lighting by basing sprite
@@ -562,11 +557,19 @@ static void R_Subsector(int num)
     if (sector->validcount != validcount && !menuactive)
     {
         sector->validcount = validcount;
-        R_AddSprites(sector, (sector->heightsec ? (ceilinglightlevel + floorlightlevel) / 2 : floorlightlevel));
+        R_AddSprites(sector, (sector->heightsec ? (sector->renderceilinglightlevel + sector->renderfloorlightlevel) / 2 :
+            sector->renderfloorlightlevel));
     }
 
+    r_stats_subsectors++;
+    r_stats_segs += count;
+
     while (count--)
         R_AddLine(line++);
+
+    // keep any visplanes split off by the segs for the sector's next subsector
+    sector->renderfloorplane = floorplane;
+    sector->renderceilingplane = ceilingplane;
 }
 
 //
@@ -579,9 +582,23 @@ void R_RenderBSPNode(int bspnum)
     while (!(bspnum & NF_SUBSECTOR))    // Found a subsector?
     {
         const node_t    *bsp = nodes + bspnum;
+        int             side;
+
+        // nothing more can be seen once the whole view is solid
+        if (r_occlusion && firstopencol > lastopencol)
+            return;
+
+        // nor in a subtree that can't be seen from the view's sector
+        if (pvs && !PVSVISIBLE(numsubsectors + bspnum))
+        {
+            r_stats_pvsculled++;
+            return;
+        }
 
         // Decide which side the view point is on.
-        int             side = R_PointOnSide(viewx, viewy, bsp);
+        side = R_PointOnSide(viewx, viewy, bsp);
+
+        r_stats_nodes++;
 
         // Recursively divide front space.
         R_RenderBSPNode(bsp->children[side]);
@@ -593,5 +610,10 @@ void R_RenderBSPNode(int bspnum)
         bspnum = bsp->children[side];
     }
 
-    R_Subsector(bspnum == -1 ? 0 : (bspnum & ~NF_SUBSECTOR));
+    bspnum = (bspnum == -1 ? 0 : (bspnum & ~NF_SUBSECTOR));
+
+    if (pvs && !PVSVISIBLE(bspnum))
+        r_stats_pvsculled++;
+    else
+        R_Subsector(bspnum);
 }
@@ -48,6 +48,8 @@ extern drawseg_t    *drawsegs;
 
 extern byte         *solidcol;
 
+extern const byte   *pvs;
+
 extern drawseg_t    *ds_p;
 
 // BSP?
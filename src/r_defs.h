@@ -161,6 +161,16 @@ typedef struct sector_s
     fixed_t             interpfloorheight;
     fixed_t             interpceilingheight;
 
+    // Worked out by R_Subsector() the first time one of the
+    //      sector's subsectors is rendered in a frame, and reused
+    //      for the rest of them.
+    int                 rendervalidcount;
+    struct sector_s     *renderfakeflat;
+    struct visplane_s   *renderfloorplane;
+    struct visplane_s   *renderceilingplane;
+    int                 renderfloorlightlevel;
+    int                 renderceilinglightlevel;
+
     // jff 2/26/98 lockout machinery for stairbuilding
     int                 stairlock;      // -2 on first locked -1 after thinker done 0 normally
     int                 prevsec;        // -1 or number of sector for previous step
@@ -779,7 +789,6 @@ typedef struct msecnode_s
     struct msecnode_s   *m_tnext;       // next msecnode_t for this thing
     struct msecnode_s   *m_sprev;       // prev msecnode_t for this sector
     struct msecnode_s   *m_snext;       // next msecnode_t for this sector
-    dboolean            visited;        // killough 4/4/98, 4/7/98: used in search algorithms
 } msecnode_t;
 
 //
@@ -1014,17 +1023,9 @@ typedef struct visplane_s
     // killough 2/28/98: Support scrolling flats
     fixed_t             xoffset, yoffset;
 
-    // leave pads for [minx - 1]/[maxx + 1]
-    unsigned int        pad1;
-
-    unsigned int        top[SCREENWIDTH];
-
-    unsigned int        pad2;
-    unsigned int        pad3;
-
-    unsigned int        bottom[SCREENWIDTH];
-
-    unsigned int        pad4;
+    // with pads for [minx - 1]/[maxx + 1]
+    unsigned int        *top;
+    unsigned int        *bottom;
 } visplane_t;
 
 #endif
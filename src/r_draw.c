@@ -60,10 +60,10 @@ int         scaledviewwidth;
 int         viewheight;
 int         viewwindowx;
 int         viewwindowy;
-int         fuzztable[SCREENWIDTH * SCREENHEIGHT];
+int         *fuzztable;
 
-static byte *ylookup0[SCREENHEIGHT];
-static byte *ylookup1[SCREENHEIGHT];
+static byte **ylookup0;
+static byte **ylookup1;
 
 static const byte redtoblue[] =
 {
@@ -166,11 +166,12 @@ void R_DrawColumn(void)
     byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturefrac;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = colormap[dc_source[frac >> FRACBITS]];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
@@ -182,11 +183,12 @@ void R_DrawColorColumn(void)
     int         y = dc_yh - dc_yl + 1;
     byte        *dest = ylookup0[dc_yl] + dc_x;
     const byte  color = dc_colormap[0][NOTEXTURECOLOR];
+    const int   screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = color;
-        dest += SCREENWIDTH;
+        dest += screenwidth;
     }
 
     *dest = color;
@@ -194,27 +196,28 @@ void R_DrawColorColumn(void)
 
 void R_DrawShadowColumn(void)
 {
-    int     y = dc_yh - dc_yl + 1;
-    byte    *dest = ylookup0[dc_yl] + dc_x;
+    int         y = dc_yh - dc_yl + 1;
+    byte        *dest = ylookup0[dc_yl] + dc_x;
+    const int   screenwidth = SCREENWIDTH;
 
     if (y == 1)
         *dest = *(*dest + dc_black25);
     else if (y == 2)
     {
         *dest = *(*dest + dc_black25);
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         *dest = *(*dest + dc_black25);
     }
     else
     {
         y--;
         *dest = *(*dest + dc_black25);
-        dest += SCREENWIDTH;
+        dest += screenwidth;
 
         while (--y)
         {
             *dest = *(*dest + dc_black40);
-            dest += SCREENWIDTH;
+            dest += screenwidth;
         }
 
         *dest = *(*dest + (dc_yh == dc_floorclip ? dc_black40 : dc_black25));
@@ -223,19 +226,20 @@ void R_DrawShadowColumn(void)
 
 void R_DrawFuzzyShadowColumn(void)
 {
-    int     y = dc_yh - dc_yl + 1;
-    byte    *dest = ylookup0[dc_yl] + dc_x;
+    int         y = dc_yh - dc_yl + 1;
+    byte        *dest = ylookup0[dc_yl] + dc_x;
+    const int   screenwidth = SCREENWIDTH;
 
     if (((consoleactive || freeze) && !fuzztable[fuzzpos++])
         || (!consoleactive && !freeze && !(M_Random() & 3)))
         *dest = *(*dest + dc_black25);
 
-    dest += SCREENWIDTH;
+    dest += screenwidth;
 
     while (--y)
     {
         *dest = *(*dest + dc_black25);
-        dest += SCREENWIDTH;
+        dest += screenwidth;
     }
 
     if (dc_yh < dc_floorclip
@@ -246,13 +250,14 @@ void R_DrawFuzzyShadowColumn(void)
 
 void R_DrawSolidShadowColumn(void)
 {
-    int     y = dc_yh - dc_yl + 1;
-    byte    *dest = ylookup0[dc_yl] + dc_x;
+    int         y = dc_yh - dc_yl + 1;
+    byte        *dest = ylookup0[dc_yl] + dc_x;
+    const int   screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = dc_black;
-        dest += SCREENWIDTH;
+        dest += screenwidth;
     }
 
     *dest = dc_black;
@@ -260,19 +265,20 @@ void R_DrawSolidShadowColumn(void)
 
 void R_DrawSolidFuzzyShadowColumn(void)
 {
-    int     y = dc_yh - dc_yl + 1;
-    byte    *dest = ylookup0[dc_yl] + dc_x;
+    int         y = dc_yh - dc_yl + 1;
+    byte        *dest = ylookup0[dc_yl] + dc_x;
+    const int   screenwidth = SCREENWIDTH;
 
     if (((consoleactive || freeze) && !fuzztable[fuzzpos++])
         || (!consoleactive && !freeze && !(M_Random() & 3)))
         *dest = dc_black;
 
-    dest += SCREENWIDTH;
+    dest += screenwidth;
 
     while (--y)
     {
         *dest = dc_black;
-        dest += SCREENWIDTH;
+        dest += screenwidth;
     }
 
     if (dc_yh < dc_floorclip
@@ -283,13 +289,14 @@ void R_DrawSolidFuzzyShadowColumn(void)
 
 void R_DrawBloodSplatColumn(void)
 {
-    int     y = dc_yh - dc_yl + 1;
-    byte    *dest = ylookup0[dc_yl] + dc_x;
+    int         y = dc_yh - dc_yl + 1;
+    byte        *dest = ylookup0[dc_yl] + dc_x;
+    const int   screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = *(*dest + dc_blood);
-        dest += SCREENWIDTH;
+        dest += screenwidth;
     }
 
     *dest = *(*dest + dc_blood);
@@ -297,13 +304,14 @@ void R_DrawBloodSplatColumn(void)
 
 void R_DrawSolidBloodSplatColumn(void)
 {
-    int     y = dc_yh - dc_yl + 1;
-    byte    *dest = ylookup0[dc_yl] + dc_x;
+    int         y = dc_yh - dc_yl + 1;
+    byte        *dest = ylookup0[dc_yl] + dc_x;
+    const int   screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = dc_solidblood;
-        dest += SCREENWIDTH;
+        dest += screenwidth;
     }
 
     *dest = dc_solidblood;
@@ -316,6 +324,7 @@ void R_DrawWallColumn(void)
     fixed_t             frac = dc_texturemid + (dc_yl - centery) * dc_iscale;
     const lighttable_t  *colormap = dc_colormap[0];
     fixed_t             heightmask = dc_texheight - 1;
+    const int           screenwidth = SCREENWIDTH;
 
     if (dc_texheight & heightmask)
     {
@@ -330,7 +339,7 @@ void R_DrawWallColumn(void)
         while (--y)
         {
             *dest = colormap[dc_source[frac >> FRACBITS]];
-            dest += SCREENWIDTH;
+            dest += screenwidth;
 
             if ((frac += dc_iscale) >= heightmask)
                 frac -= heightmask;
@@ -343,7 +352,7 @@ void R_DrawWallColumn(void)
         while (--y)
         {
             *dest = colormap[dc_source[(frac >> FRACBITS) & heightmask]];
-            dest += SCREENWIDTH;
+            dest += screenwidth;
             frac += dc_iscale;
         }
 
@@ -353,11 +362,12 @@ void R_DrawWallColumn(void)
 
 void R_DrawBrightMapWallColumn(void)
 {
-    int     y = dc_yh - dc_yl + 1;
-    byte    *dest = ylookup0[dc_yl] + dc_x;
-    fixed_t frac = dc_texturemid + (dc_yl - centery) * dc_iscale;
-    fixed_t heightmask = dc_texheight - 1;
-    byte    dot;
+    int         y = dc_yh - dc_yl + 1;
+    byte        *dest = ylookup0[dc_yl] + dc_x;
+    fixed_t     frac = dc_texturemid + (dc_yl - centery) * dc_iscale;
+    fixed_t     heightmask = dc_texheight - 1;
+    byte        dot;
+    const int   screenwidth = SCREENWIDTH;
 
     if (dc_texheight & heightmask)
     {
@@ -373,7 +383,7 @@ void R_DrawBrightMapWallColumn(void)
         {
             dot = dc_source[frac >> FRACBITS];
             *dest = dc_colormap[dc_brightmap[dot]][dot];
-            dest += SCREENWIDTH;
+            dest += screenwidth;
 
             if ((frac += dc_iscale) >= heightmask)
                 frac -= heightmask;
@@ -388,7 +398,7 @@ void R_DrawBrightMapWallColumn(void)
         {
             dot = dc_source[(frac >> FRACBITS) & heightmask];
             *dest = dc_colormap[dc_brightmap[dot]][dot];
-            dest += SCREENWIDTH;
+            dest += screenwidth;
             frac += dc_iscale;
         }
 
@@ -399,14 +409,15 @@ void R_DrawBrightMapWallColumn(void)
 
 void R_DrawPlayerSpriteColumn(void)
 {
-    int     y = dc_yh - dc_yl + 1;
-    byte    *dest = ylookup1[dc_yl] + dc_x;
-    fixed_t frac = dc_texturefrac;
+    int         y = dc_yh - dc_yl + 1;
+    byte        *dest = ylookup1[dc_yl] + dc_x;
+    fixed_t     frac = dc_texturefrac;
+    const int   screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = dc_source[frac >> FRACBITS];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
@@ -419,6 +430,7 @@ void R_DrawSuperShotgunColumn(void)
     byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturefrac;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     while (--y)
     {
@@ -427,7 +439,7 @@ void R_DrawSuperShotgunColumn(void)
         if (dot != 71)
             *dest = colormap[dot];
 
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
@@ -440,6 +452,7 @@ void R_DrawTranslucentSuperShotgunColumn(void)
     byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturefrac;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     while (--y)
     {
@@ -448,7 +461,7 @@ void R_DrawTranslucentSuperShotgunColumn(void)
         if (dot != 71)
             *dest = tinttabredwhite1[(*dest << 8) + colormap[dot]];
 
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
@@ -461,13 +474,14 @@ void R_DrawSkyColumn(void)
     byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturemid + (dc_yl - centery) * dc_iscale;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     if (dc_texheight == 128)
     {
         while (y--)
         {
             *dest = colormap[dc_source[(frac & ((127 << FRACBITS) | 0xFFFF)) >> FRACBITS]];
-            dest += SCREENWIDTH;
+            dest += screenwidth;
             frac += dc_iscale;
         }
     }
@@ -482,10 +496,10 @@ void R_DrawSkyColumn(void)
             while ((y -= 2) >= 0)
             {
                 *dest = colormap[dc_source[(frac & heightmask) >> FRACBITS]];
-                dest += SCREENWIDTH;
+                dest += screenwidth;
                 frac += dc_iscale;
                 *dest = colormap[dc_source[(frac & heightmask) >> FRACBITS]];
-                dest += SCREENWIDTH;
+                dest += screenwidth;
                 frac += dc_iscale;
             }
 
@@ -505,7 +519,7 @@ void R_DrawSkyColumn(void)
             while (y--)
             {
                 *dest = colormap[dc_source[frac >> FRACBITS]];
-                dest += SCREENWIDTH;
+                dest += screenwidth;
 
                 if ((frac += dc_iscale) >= heightmask)
                     frac -= heightmask;
@@ -521,11 +535,12 @@ void R_DrawFlippedSkyColumn(void)
     fixed_t             frac = dc_texturemid + (dc_yl - centery) * dc_iscale;
     const lighttable_t  *colormap = dc_colormap[0];
     fixed_t             i;
+    const int           screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = colormap[dc_source[(i = frac >> FRACBITS) < 128 ? i : 126 - (i & 127)]];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
@@ -537,11 +552,12 @@ void R_DrawSkyColorColumn(void)
     int         y = dc_yh - dc_yl + 1;
     byte        *dest = ylookup0[dc_yl] + dc_x;
     const byte  color = dc_colormap[0][r_skycolor];
+    const int   screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = color;
-        dest += SCREENWIDTH;
+        dest += screenwidth;
     }
 
     *dest = color;
@@ -553,11 +569,12 @@ void R_DrawRedToBlueColumn(void)
     byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturefrac;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = colormap[redtoblue[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
@@ -570,11 +587,12 @@ void R_DrawTranslucentRedToBlue33Column(void)
     byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturefrac;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = tinttab33[(*dest << 8) + colormap[redtoblue[dc_source[frac >> FRACBITS]]]];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
@@ -587,11 +605,12 @@ void R_DrawRedToGreenColumn(void)
     byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturefrac;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = colormap[redtogreen[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
@@ -604,11 +623,12 @@ void R_DrawTranslucentRedToGreen33Column(void)
     byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturefrac;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = tinttab33[(*dest << 8) + colormap[redtogreen[dc_source[frac >> FRACBITS]]]];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
@@ -621,11 +641,12 @@ void R_DrawTranslucentColumn(void)
     byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturefrac;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = tinttabadditive[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
@@ -639,11 +660,12 @@ void R_DrawTranslucent50Column(void)
     fixed_t             frac = dc_texturefrac + SPARKLEFIX;
     const fixed_t       fracstep = dc_iscale - SPARKLEFIX;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = tranmap[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += fracstep;
     }
 
@@ -655,11 +677,12 @@ void R_DrawTranslucentColor50Column(void)
     int         y = dc_yh - dc_yl + 1;
     byte        *dest = ylookup0[dc_yl] + dc_x;
     const byte  color = dc_colormap[0][NOTEXTURECOLOR];
+    const int   screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = tranmap[(*dest << 8) + color];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
     }
 
     *dest = tranmap[(*dest << 8) + color];
@@ -672,20 +695,21 @@ void R_DrawDitheredColumn(void)
     fixed_t             frac = dc_texturefrac + SPARKLEFIX;
     const fixed_t       fracstep = (dc_iscale << 1) - SPARKLEFIX;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     if ((dc_yl ^ dc_x) & 1)
     {
         if (!--y)
             return;
 
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
     do
     {
         *dest = colormap[dc_source[frac >> FRACBITS]];
-        dest += SCREENWIDTH << 1;
+        dest += screenwidth << 1;
         frac += fracstep;
     } while ((y -= 2) > 0);
 }
@@ -695,19 +719,20 @@ void R_DrawDitheredColorColumn(void)
     int         y = dc_yh - dc_yl + 1;
     byte        *dest = ylookup0[dc_yl] + dc_x;
     const byte  color = dc_colormap[0][NOTEXTURECOLOR];
+    const int   screenwidth = SCREENWIDTH;
 
     if ((dc_yl ^ dc_x) & 1)
     {
         if (!--y)
             return;
 
-        dest += SCREENWIDTH;
+        dest += screenwidth;
     }
 
     do
     {
         *dest = color;
-        dest += SCREENWIDTH << 1;
+        dest += screenwidth << 1;
     } while ((y -= 2) > 0);
 }
 
@@ -717,11 +742,12 @@ void R_DrawTranslucent33Column(void)
     byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturefrac;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = tinttab33[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
@@ -734,11 +760,12 @@ void R_DrawMegaSphereColumn(void)
     byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturefrac;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = tinttab33[(*dest << 8) + colormap[megasphere[dc_source[frac >> FRACBITS]]]];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
@@ -751,11 +778,12 @@ void R_DrawSolidMegaSphereColumn(void)
     byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturefrac;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = colormap[megasphere[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
@@ -768,11 +796,12 @@ void R_DrawTranslucentRedColumn(void)
     byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturefrac;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = tinttabred[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
@@ -785,11 +814,12 @@ void R_DrawTranslucentRedWhiteColumn1(void)
     byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturefrac;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = tinttabredwhite1[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
@@ -802,11 +832,12 @@ void R_DrawTranslucentRedWhiteColumn2(void)
     byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturefrac;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = tinttabredwhite2[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
@@ -819,11 +850,12 @@ void R_DrawTranslucentRedWhite50Column(void)
     byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturefrac;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = tinttabredwhite50[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
@@ -836,11 +868,12 @@ void R_DrawTranslucentGreenColumn(void)
     byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturefrac;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = tinttabgreen[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
@@ -853,11 +886,12 @@ void R_DrawTranslucentBlueColumn(void)
     byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturefrac;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = tinttabblue[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
@@ -870,11 +904,12 @@ void R_DrawTranslucentRed33Column(void)
     byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturefrac;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = tinttabred33[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
@@ -887,11 +922,12 @@ void R_DrawTranslucentGreen33Column(void)
     byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturefrac;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = tinttabgreen33[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
@@ -904,11 +940,12 @@ void R_DrawTranslucentBlue25Column(void)
     byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturefrac;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = tinttabblue25[(*dest << 8) + colormap[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
@@ -920,12 +957,13 @@ void R_DrawTranslucentBlue25Column(void)
 //
 #define NOFUZZ  251
 
-const int       fuzzrange[3] = { -SCREENWIDTH, 0, SCREENWIDTH };
+int             fuzzrange[3];
 
 void R_DrawFuzzColumn(void)
 {
-    byte    *dest = ylookup0[dc_yl] + dc_x;
-    int     y = dc_yh - dc_yl;
+    byte        *dest = ylookup0[dc_yl] + dc_x;
+    int         y = dc_yh - dc_yl;
+    const int   screenwidth = SCREENWIDTH;
 
     if (!y)
         return;
@@ -936,13 +974,13 @@ void R_DrawFuzzColumn(void)
     else if (!(M_Random() & 3))
         *dest = fullcolormap[12 * 256 + dest[(fuzztable[fuzzpos++] = FUZZ(-1, 1))]];
 
-    dest += SCREENWIDTH;
+    dest += screenwidth;
 
     while (--y)
     {
         // middle
         *dest = fullcolormap[6 * 256 + dest[(fuzztable[fuzzpos++] = FUZZ(-1, 1))]];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
     }
 
     // bottom
@@ -950,15 +988,16 @@ void R_DrawFuzzColumn(void)
 
     if (dc_yh < dc_floorclip && !(M_Random() & 3))
     {
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         *dest = fullcolormap[14 * 256 + dest[(fuzztable[fuzzpos] = FUZZ(-1, 0))]];
     }
 }
 
 void R_DrawPausedFuzzColumn(void)
 {
-    byte    *dest = ylookup0[dc_yl] + dc_x;
-    int     y = dc_yh - dc_yl;
+    byte        *dest = ylookup0[dc_yl] + dc_x;
+    int         y = dc_yh - dc_yl;
+    const int   screenwidth = SCREENWIDTH;
 
     if (!y)
         return;
@@ -968,21 +1007,21 @@ void R_DrawPausedFuzzColumn(void)
     {
         *dest = fullcolormap[6 * 256 + dest[MAX(0, fuzztable[fuzzpos++])]];
 
-        if (fuzzpos == SCREENWIDTH * SCREENHEIGHT)
+        if (fuzzpos == screenwidth * SCREENHEIGHT)
             fuzzpos = 0;
     }
     else if (!fuzztable[fuzzpos++])
         *dest = fullcolormap[12 * 256 + dest[fuzztable[fuzzpos++]]];
 
-    dest += SCREENWIDTH;
+    dest += screenwidth;
 
     while (--y)
     {
         // middle
         *dest = fullcolormap[6 * 256 + dest[fuzztable[fuzzpos++]]];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
 
-        if (fuzzpos == SCREENWIDTH * SCREENHEIGHT)
+        if (fuzzpos == screenwidth * SCREENHEIGHT)
             fuzzpos = 0;
     }
 
@@ -991,7 +1030,7 @@ void R_DrawPausedFuzzColumn(void)
 
     if (dc_yh < dc_floorclip && !fuzztable[fuzzpos++])
     {
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         *dest = fullcolormap[12 * 256 + dest[fuzztable[fuzzpos]]];
     }
 }
@@ -1000,9 +1039,10 @@ void R_DrawFuzzColumns(void)
 {
     const int   w = viewwindowx + viewwidth;
     const int   h = (viewwindowy + viewheight) * SCREENWIDTH;
+    const int   screenwidth = SCREENWIDTH;
 
     for (int x = viewwindowx; x < w; x++)
-        for (int y = viewwindowy * SCREENWIDTH; y < h; y += SCREENWIDTH)
+        for (int y = viewwindowy * screenwidth; y < h; y += screenwidth)
         {
             const int   i = x + y;
             byte        *src = screens[1] + i;
@@ -1011,18 +1051,18 @@ void R_DrawFuzzColumns(void)
             {
                 byte    *dest = screens[0] + i;
 
-                if (!y || *(src - SCREENWIDTH) == NOFUZZ)
+                if (!y || *(src - screenwidth) == NOFUZZ)
                 {
                     // top
                     if (!(M_Random() & 3))
                         *dest = fullcolormap[12 * 256 + dest[(fuzztable[i] = FUZZ(-1, 1))]];
                 }
-                else if (y == h - SCREENWIDTH)
+                else if (y == h - screenwidth)
                 {
                     // bottom of view
                     *dest = fullcolormap[5 * 256 + dest[(fuzztable[i] = FUZZ(-1, 0))]];
                 }
-                else if (*(src + SCREENWIDTH) == NOFUZZ)
+                else if (*(src + screenwidth) == NOFUZZ)
                 {
                     // bottom of post
                     if (!(M_Random() & 3))
@@ -1047,9 +1087,10 @@ void R_DrawPausedFuzzColumns(void)
 {
     const int   w = viewwindowx + viewwidth;
     const int   h = (viewwindowy + viewheight) * SCREENWIDTH;
+    const int   screenwidth = SCREENWIDTH;
 
     for (int x = viewwindowx; x < w; x++)
-        for (int y = viewwindowy * SCREENWIDTH; y < h; y += SCREENWIDTH)
+        for (int y = viewwindowy * screenwidth; y < h; y += screenwidth)
         {
             const int   i = x + y;
             byte        *src = screens[1] + i;
@@ -1058,18 +1099,18 @@ void R_DrawPausedFuzzColumns(void)
             {
                 byte    *dest = screens[0] + i;
 
-                if (!y || *(src - SCREENWIDTH) == NOFUZZ)
+                if (!y || *(src - screenwidth) == NOFUZZ)
                 {
                     // top
                     if (!fuzztable[i])
                         *dest = fullcolormap[12 * 256 + dest[fuzztable[i]]];
                 }
-                else if (y == h - SCREENWIDTH)
+                else if (y == h - screenwidth)
                 {
                     // bottom of view
                     *dest = fullcolormap[5 * 256 + dest[fuzztable[i]]];
                 }
-                else if (*(src + SCREENWIDTH) == NOFUZZ)
+                else if (*(src + screenwidth) == NOFUZZ)
                 {
                     // bottom of post
                     if (!fuzztable[i])
@@ -1108,11 +1149,12 @@ void R_DrawTranslatedColumn(void)
     byte                *dest = ylookup0[dc_yl] + dc_x;
     fixed_t             frac = dc_texturefrac;
     const lighttable_t  *colormap = dc_colormap[0];
+    const int           screenwidth = SCREENWIDTH;
 
     while (--y)
     {
         *dest = colormap[dc_translation[dc_source[frac >> FRACBITS]]];
-        dest += SCREENWIDTH;
+        dest += screenwidth;
         frac += dc_iscale;
     }
 
@@ -1204,6 +1246,17 @@ void R_DrawColorSpan(void)
     *dest = color;
 }
 
+//
+// R_InitDrawBuffers
+// Allocates the buffers sized from the screen. Called at program start.
+//
+void R_InitDrawBuffers(void)
+{
+    fuzztable = malloc(SCREENWIDTH * SCREENHEIGHT * sizeof(*fuzztable));
+    ylookup0 = malloc(SCREENHEIGHT * sizeof(*ylookup0));
+    ylookup1 = malloc(SCREENHEIGHT * sizeof(*ylookup1));
+}
+
 //
 // R_InitBuffer
 //
@@ -1221,6 +1274,9 @@ void R_InitBuffer(int width, int height)
         ylookup1[i] = screens[1] + y;
     }
 
+    fuzzrange[0] = -SCREENWIDTH;
+    fuzzrange[2] = SCREENWIDTH;
+
     for (int y = 1; y < SCREENHEIGHT - 1; y++)
         for (int x = 0; x < SCREENWIDTH; x++)
             fuzztable[y * SCREENWIDTH + x] = FUZZ(-1, 1);
@@ -1251,15 +1307,14 @@ void R_FillBackScreen(void)
     src = (byte *)grnrock;
     dest = screens[1];
 
-    for (int y = 0; y < SCREENHEIGHT - SBARHEIGHT; y += 2)
-        for (int x = 0; x < SCREENWIDTH / 32; x += 2, dest += 128)
-            for (int i = 0; i < 128; i += 2)
-                dest[i] = dest[i + 1] = src[(((y / 2) & 63) << 6) + i / 2];
+    for (int y = 0; y < SCREENHEIGHT - SBARHEIGHT; y++)
+        for (int x = 0; x < SCREENWIDTH; x++)
+            *dest++ = src[(((y / SCREENSCALE) & 63) << 6) + ((x / SCREENSCALE) & 63)];
 
-    x1 = viewwindowx / 2;
-    y1 = viewwindowy / 2;
-    x2 = scaledviewwidth / 2 + x1;
-    y2 = viewheight / 2 + y1;
+    x1 = viewwindowx / SCREENSCALE;
+    y1 = viewwindowy / SCREENSCALE;
+    x2 = scaledviewwidth / SCREENSCALE + x1;
+    y2 = viewheight / SCREENSCALE + y1;
 
     for (int x = x1; x < x2 - 8; x += 8)
     {
@@ -69,8 +69,8 @@ extern byte             *dc_black40;
 // first pixel in a column
 extern byte             *dc_source;
 
-extern const int        fuzzrange[3];
-extern int              fuzztable[SCREENWIDTH * SCREENHEIGHT];
+extern int              fuzzrange[3];
+extern int              *fuzztable;
 
 // The span blitting interface.
 // Hook in assembler or system specific BLT here.
@@ -147,6 +147,7 @@ extern byte         *dc_translation;
 void R_DrawSpan(void);
 void R_DrawColorSpan(void);
 
+void R_InitDrawBuffers(void);
 void R_InitBuffer(int width, int height);
 
 // Initialize color translation tables,
@@ -65,6 +65,12 @@ int                 centery;
 fixed_t             centerxfrac;
 fixed_t             centeryfrac;
 fixed_t             projection;
+fixed_t             projectiony;
+
+// width of each column rendered in the view relative to a pixel on the screen.
+//  Greater than FRACUNIT when r_detail is low or r_dynamicresolution has lowered the
+//  width of the view, with the view widened by V_ExpandView() when done
+fixed_t             viewcolumnscale = FRACUNIT;
 
 fixed_t             viewx;
 fixed_t             viewy;
@@ -81,6 +87,24 @@ player_t            *viewplayer = NULL;
 //      range of [0.0, 1.0). Used for interpolation.
 fixed_t             fractionaltic;
 
+dboolean            interpolatesprites;
+dboolean            pausesprites;
+
+dboolean            r_showstats = r_showstats_default;
+int                 r_stats_drawsegs;
+int                 r_stats_maskedposts;
+int                 r_stats_nodes;
+int                 r_stats_pvsculled;
+int                 r_stats_segs;
+int                 r_stats_skycolumns;
+int                 r_stats_spanpixels;
+int                 r_stats_spriteposts;
+int                 r_stats_subsectors;
+int                 r_stats_visplanes;
+int                 r_stats_visplanes_chain;
+int                 r_stats_vissprites;
+int                 r_stats_walldraws;
+
 //
 // precalculated math tables
 //
@@ -95,7 +119,7 @@ int                 viewangletox[FINEANGLES / 2];
 // The xtoviewangleangle[] table maps a screen pixel
 // to the lowest viewangle that maps back to x ranges
 // from clipangle to -clipangle.
-angle_t             xtoviewangle[SCREENWIDTH + 1];
+angle_t             *xtoviewangle;
 
 fixed_t             finesine[5 * FINEANGLES / 4];
 fixed_t             *finecosine = &finesine[FINEANGLES / 4];
@@ -121,6 +145,11 @@ dboolean            drawbloodsplats;
 
 dboolean            r_bloodsplats_translucency = r_bloodsplats_translucency_default;
 dboolean            r_dither = r_dither_default;
+int                 r_dynamicresolution = r_dynamicresolution_default;
+int                 r_dynamicresolution_budget;
+int                 r_dynamicresolution_rendertime;
+int                 r_dynamicresolution_scale = 100;
+int                 r_dynamicresolution_step;
 int                 r_fov = r_fov_default;
 dboolean            r_homindicator = r_homindicator_default;
 dboolean            r_shadows_translucency = r_shadows_translucency_default;
@@ -403,6 +432,49 @@ void R_SetViewSize(int blocks)
     setblocks = blocks + 3;
 }
 
+//
+// R_GetViewWidth
+// the width the view is rendered at before being widened to scaledviewwidth
+//
+static int R_GetViewWidth(void)
+{
+    int width = scaledviewwidth * r_dynamicresolution_scale / 100;
+
+    if (r_detail == r_detail_low)
+        width = (width + pixelwidth - 1) / pixelwidth;
+
+    return MAX(2, width);
+}
+
+//
+// R_SetViewWidth
+// set up everything that depends on the width the view is rendered at, which
+//  can change between frames with r_detail, r_lowpixelsize and r_dynamicresolution
+//
+static void R_SetViewWidth(void)
+{
+    const fixed_t   fovscale = finetangent[FINEANGLES / 4 + r_fov * FINEANGLES / 360 / 2];
+
+    viewwidth = R_GetViewWidth();
+    centerx = viewwidth / 2;
+    centerxfrac = centerx << FRACBITS;
+
+    // vertical scaling is always done at full resolution, and the horizontal
+    //  projection is derived from the same ratio V_ExpandView() widens the view by
+    projectiony = FixedDiv((scaledviewwidth / 2) << FRACBITS, fovscale);
+    viewcolumnscale = (scaledviewwidth << FRACBITS) / viewwidth;
+    projection = FixedDiv(projectiony, viewcolumnscale);
+
+    R_InitTextureMapping();
+
+    pspritexscale = FixedDiv(pspritescale, viewcolumnscale);
+    pspritexiscale = FixedMul(pspriteiscale, viewcolumnscale);
+
+    // thing clipping
+    for (int i = 0; i < viewwidth; i++)
+        viewheightarray[i] = viewheight;
+}
+
 //
 // R_ExecuteSetViewSize
 //
@@ -427,26 +499,18 @@ void R_ExecuteSetViewSize(void)
         viewheight = (setblocks * (SCREENHEIGHT - SBARHEIGHT) / 10) & ~7;
     }
 
-    viewwidth = scaledviewwidth;
-
-    centerx = viewwidth / 2;
-    centerxfrac = centerx << FRACBITS;
-    fovscale = finetangent[FINEANGLES / 4 + r_fov * FINEANGLES / 360 / 2];
-    projection = FixedDiv(centerxfrac, fovscale);
-
     R_InitBuffer(scaledviewwidth, viewheight);
-    R_InitTextureMapping();
 
     // psprite scales
-    pspritescale = FixedDiv(viewwidth, ORIGINALWIDTH);
+    pspritescale = FixedDiv(scaledviewwidth, ORIGINALWIDTH);
     pspriteiscale = FixedDiv(FRACUNIT, pspritescale);
 
-    // thing clipping
-    for (int i = 0; i < viewwidth; i++)
-        viewheightarray[i] = viewheight;
+    fovscale = finetangent[FINEANGLES / 4 + r_fov * FINEANGLES / 360 / 2];
+
+    R_SetViewWidth();
 
     // planes
-    num = FixedMul(FixedDiv(FRACUNIT, fovscale), viewwidth * (FRACUNIT / 2));
+    num = FixedMul(FixedDiv(FRACUNIT, fovscale), scaledviewwidth * (FRACUNIT / 2));
 
     for (int i = 0; i < viewheight; i++)
         for (int j = 0; j < LOOKDIRS; j++)
@@ -463,7 +527,7 @@ void R_ExecuteSetViewSize(void)
 
         for (int j = 0; j < MAXLIGHTSCALE; j++)
         {
-            const int   level = BETWEEN(0, start - j * SCREENWIDTH / (viewwidth * DISTMAP), NUMCOLORMAPS - 1) * 256;
+            const int   level = BETWEEN(0, start - j * SCREENWIDTH / (scaledviewwidth * DISTMAP), NUMCOLORMAPS - 1) * 256;
 
             // killough 3/20/98: initialize multiple colormaps
             for (int t = 0; t < numcolormaps; t++)
@@ -713,6 +777,10 @@ void R_InitColumnFunctions(void)
 //
 void R_Init(void)
 {
+    xtoviewangle = malloc((SCREENWIDTH + 1) * sizeof(*xtoviewangle));
+
+    R_InitDrawBuffers();
+    R_InitPlanes();
     R_InitClipSegs();
     R_InitData();
     R_InitPointToAngle();
@@ -748,6 +816,59 @@ subsector_t *R_PointInSubsector(fixed_t x, fixed_t y)
     }
 }
 
+//
+// R_InterpolateFrame
+// Work out where moving sectors and things are to be drawn this frame
+// once, before the BSP is walked, rather than each time they are visited.
+//
+static void R_InterpolateFrame(void)
+{
+    const dboolean  interpolatesectors = (vid_capfps != TICRATE);
+
+    pausesprites = (menuactive || paused || consoleactive || freeze);
+    interpolatesprites = (interpolatesectors && !pausesprites);
+
+    for (int i = 0; i < numsectors; i++)
+    {
+        sector_t    *sector = sectors + i;
+
+        // [AM] Only if we moved the sector last tic.
+        if (interpolatesectors && sector->oldgametime == gametime - 1)
+        {
+            sector->interpfloorheight = sector->oldfloorheight
+                + FixedMul(sector->floorheight - sector->oldfloorheight, fractionaltic);
+            sector->interpceilingheight = sector->oldceilingheight
+                + FixedMul(sector->ceilingheight - sector->oldceilingheight, fractionaltic);
+        }
+        else
+        {
+            sector->interpfloorheight = sector->floorheight;
+            sector->interpceilingheight = sector->ceilingheight;
+        }
+    }
+
+    if (!interpolatesprites)
+        return;
+
+    for (thinker_t *th = thinkers[th_mobj].cnext; th != &thinkers[th_mobj]; th = th->cnext)
+    {
+        mobj_t  *mo = (mobj_t *)th;
+
+        if (mo->interpolate)
+        {
+            mo->interpx = mo->oldx + FixedMul(mo->x - mo->oldx, fractionaltic);
+            mo->interpy = mo->oldy + FixedMul(mo->y - mo->oldy, fractionaltic);
+            mo->interpz = mo->oldz + FixedMul(mo->z - mo->oldz, fractionaltic);
+        }
+        else
+        {
+            mo->interpx = mo->x;
+            mo->interpy = mo->y;
+            mo->interpz = mo->z;
+        }
+    }
+}
+
 //
 // R_SetupFrame
 //
@@ -863,14 +984,89 @@ static void R_SetupFrame(void)
         usebrightmaps = (r_brightmaps && !cm && !BTSX);
     }
 
+    // only render what might be seen from the sector the view is in
+    pvs = (r_pvs && pvsrows && !(viewplayer->cheats & CF_NOCLIP) ?
+        P_GetPVS(R_PointInSubsector(viewx, viewy)->sector->id) : NULL);
+
     validcount++;
 }
 
+//
+// R_UpdateDynamicResolution
+// given how long the view took to render, lower r_dynamicresolution_scale
+//  if the view is taking too much of each frame at the framerate set by
+//  r_dynamicresolution, or raise it again once there is time to spare. Averaged
+//  over several frames so the width of the view doesn't change constantly.
+//
+#define DYNAMICRESFRAMES    16
+#define DYNAMICRESMINSCALE  50
+
+static void R_UpdateDynamicResolution(uint64_t rendertime)
+{
+    static uint64_t totalrendertime;
+    static int      frames;
+    uint64_t        budget;
+    int             scale = r_dynamicresolution_scale;
+
+    totalrendertime += rendertime;
+
+    if (++frames < DYNAMICRESFRAMES)
+        return;
+
+    // leave a quarter of each frame for everything else
+    budget = 750000000ull * DYNAMICRESFRAMES / r_dynamicresolution;
+
+    if (totalrendertime > budget)
+        scale = MAX(DYNAMICRESMINSCALE, scale - 10);
+    else if (totalrendertime < budget * 2 / 3)
+        scale = MIN(100, scale + 5);
+
+    // show what was decided, and why, in microseconds per frame
+    r_dynamicresolution_rendertime = (int)(totalrendertime / (DYNAMICRESFRAMES * 1000));
+    r_dynamicresolution_budget = (int)(budget / (DYNAMICRESFRAMES * 1000));
+    r_dynamicresolution_step = scale - r_dynamicresolution_scale;
+    r_dynamicresolution_scale = scale;
+    totalrendertime = 0;
+    frames = 0;
+}
+
+//
+// R_ClearStats
+//
+static void R_ClearStats(void)
+{
+    r_stats_drawsegs = 0;
+    r_stats_maskedposts = 0;
+    r_stats_nodes = 0;
+    r_stats_pvsculled = 0;
+    r_stats_segs = 0;
+    r_stats_skycolumns = 0;
+    r_stats_spanpixels = 0;
+    r_stats_spriteposts = 0;
+    r_stats_subsectors = 0;
+    r_stats_visplanes = 0;
+    r_stats_visplanes_chain = 0;
+    r_stats_vissprites = 0;
+    r_stats_walldraws = 0;
+}
+
 //
 // R_RenderPlayerView
 //
 void R_RenderPlayerView(void)
 {
+    uint64_t    rendertime = I_GetTimeNS();
+
+    // r_detail, r_lowpixelsize or r_dynamicresolution_scale may have changed
+    if (R_GetViewWidth() != viewwidth)
+        R_SetViewWidth();
+
+    R_ClearStats();
+
+    PROFILE_START(PROFILE_R_INTERPOLATEFRAME);
+    R_InterpolateFrame();
+    PROFILE_END(PROFILE_R_INTERPOLATEFRAME);
+
     R_SetupFrame();
 
     // Clear buffers.
@@ -881,7 +1077,11 @@ void R_RenderPlayerView(void)
 
     if (automapactive)
     {
+        PROFILE_START(PROFILE_R_RENDERBSPNODE);
         R_RenderBSPNode(numnodes - 1);
+        PROFILE_END(PROFILE_R_RENDERBSPNODE);
+
+        r_stats_drawsegs = (int)(ds_p - drawsegs);
         return;
     }
 
@@ -892,10 +1092,33 @@ void R_RenderPlayerView(void)
         V_FillRect(0, viewwindowx, viewwindowy, viewwidth, viewheight,
             nearestcolors[(viewplayer->fixedcolormap == INVERSECOLORMAP ? WHITE : BLACK)], false);
 
+    PROFILE_START(PROFILE_R_RENDERBSPNODE);
     R_RenderBSPNode(numnodes - 1);  // head node is the last node output
+    PROFILE_END(PROFILE_R_RENDERBSPNODE);
+
+    r_stats_drawsegs = (int)(ds_p - drawsegs);
+
+    PROFILE_START(PROFILE_R_DRAWPLANES);
     R_DrawPlanes();
+    PROFILE_END(PROFILE_R_DRAWPLANES);
+
+    PROFILE_START(PROFILE_R_DRAWMASKED);
     R_DrawMasked();
+    PROFILE_END(PROFILE_R_DRAWMASKED);
 
     if (!r_textures && viewplayer->fixedcolormap == INVERSECOLORMAP)
         V_InvertScreen();
+
+    if (viewwidth != scaledviewwidth || r_detail == r_detail_low)
+        V_ExpandView();
+
+    if (r_dynamicresolution)
+        R_UpdateDynamicResolution(I_GetTimeNS() - rendertime);
+    else
+    {
+        r_dynamicresolution_budget = 0;
+        r_dynamicresolution_rendertime = 0;
+        r_dynamicresolution_scale = 100;
+        r_dynamicresolution_step = 0;
+    }
 }
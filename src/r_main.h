@@ -56,6 +56,8 @@ extern int      centery;
 extern fixed_t  centerxfrac;
 extern fixed_t  centeryfrac;
 extern fixed_t  projection;
+extern fixed_t  projectiony;
+extern fixed_t  viewcolumnscale;
 
 extern int      validcount;
 
@@ -96,6 +98,9 @@ extern lighttable_t *fixedcolormap;
 //      range of [0.0, 1.0). Used for interpolation.
 extern fixed_t      fractionaltic;
 
+extern dboolean     interpolatesprites;
+extern dboolean     pausesprites;
+
 //
 // Function pointers to switch refresh/drawing functions.
 // Used to select shadow mode etc.
@@ -44,10 +44,14 @@
 #include "p_local.h"
 #include "r_sky.h"
 #include "w_wad.h"
+#include "z_zone.h"
 
-#define MAXVISPLANES    128                     // must be a power of 2
+#define MINVISPLANEBUCKETS  128                 // must be a power of 2
+#define MAXVISPLANELOAD     2                   // most visplanes per bucket before the hash grows
 
-static visplane_t   *visplanes[MAXVISPLANES];   // killough
+static visplane_t   **visplanes;                // killough
+static unsigned int numvisplanebuckets = MINVISPLANEBUCKETS;
+static unsigned int numvisplanes;
 static visplane_t   *freetail;                  // killough
 static visplane_t   **freehead = &freetail;     // killough
 visplane_t          *floorplane;
@@ -55,8 +59,9 @@ visplane_t          *ceilingplane;
 
 // killough -- hash function for visplanes
 // Empirically verified to be fairly uniform:
+// Use the integer part of height, since its fractional part is almost always 0
 #define visplane_hash(picnum, lightlevel, height) \
-    ((unsigned int)((picnum) * 3 + (lightlevel) + (height) * 7) & (MAXVISPLANES - 1))
+    ((unsigned int)((picnum) * 3 + (lightlevel) + ((height) >> FRACBITS) * 7) & (numvisplanebuckets - 1))
 
 int                 *openings;                  // dropoff overflow
 int                 *lastopening;               // dropoff overflow
@@ -64,8 +69,8 @@ int                 *lastopening;               // dropoff overflow
 // Clip values are the solid pixel bounding the range.
 //  floorclip starts out SCREENHEIGHT
 //  ceilingclip starts out -1
-int                 floorclip[SCREENWIDTH];     // dropoff overflow
-int                 ceilingclip[SCREENWIDTH];   // dropoff overflow
+int                 *floorclip;                 // dropoff overflow
+int                 *ceilingclip;               // dropoff overflow
 
 // texture mapping
 static lighttable_t **planezlight;
@@ -74,9 +79,18 @@ static fixed_t      planeheight;
 static fixed_t      xoffset, yoffset;           // killough 2/28/98: flat offsets
 
 fixed_t             *yslope;
-fixed_t             yslopes[LOOKDIRS][SCREENHEIGHT];
+fixed_t             *yslopes[LOOKDIRS];
 
-static fixed_t      cachedheight[SCREENHEIGHT];
+static fixed_t      *cachedheight;
+static fixed_t      *cacheddistance;
+static fixed_t      *cachedviewcosdistance;
+static fixed_t      *cachedviewsindistance;
+static fixed_t      *cachedxstep;
+static fixed_t      *cachedystep;
+
+// spanstart holds the start of a plane span
+// initialized to 0 at start
+static int          *spanstart;
 
 dboolean            r_liquid_current = r_liquid_current_default;
 dboolean            r_liquid_swirl = r_liquid_swirl_default;
@@ -90,15 +104,10 @@ extern dboolean     canmouselook;
 //
 static void R_MapPlane(int y, int x1, int x2)
 {
-    static fixed_t  cacheddistance[SCREENHEIGHT];
-    static fixed_t  cachedviewcosdistance[SCREENHEIGHT];
-    static fixed_t  cachedviewsindistance[SCREENHEIGHT];
-    static fixed_t  cachedxstep[SCREENHEIGHT];
-    static fixed_t  cachedystep[SCREENHEIGHT];
-    fixed_t         distance;
-    fixed_t         viewcosdistance;
-    fixed_t         viewsindistance;
-    int             dx;
+    fixed_t distance;
+    fixed_t viewcosdistance;
+    fixed_t viewsindistance;
+    int     dx;
 
     if (planeheight != cachedheight[y])
     {
@@ -111,8 +120,8 @@ static void R_MapPlane(int y, int x1, int x2)
         distance = cacheddistance[y] = FixedMul(planeheight, yslope[y]);
         viewcosdistance = cachedviewcosdistance[y] = FixedMul(viewcos, distance);
         viewsindistance = cachedviewsindistance[y] = FixedMul(viewsin, distance);
-        ds_xstep = cachedxstep[y] = FixedMul(viewsin, planeheight) / dy;
-        ds_ystep = cachedystep[y] = FixedMul(viewcos, planeheight) / dy;
+        ds_xstep = cachedxstep[y] = (fixed_t)(((int64_t)FixedMul(viewsin, planeheight) * viewcolumnscale >> FRACBITS) / dy);
+        ds_ystep = cachedystep[y] = (fixed_t)(((int64_t)FixedMul(viewcos, planeheight) * viewcolumnscale >> FRACBITS) / dy);
     }
     else
     {
@@ -134,6 +143,28 @@ static void R_MapPlane(int y, int x1, int x2)
     ds_x2 = x2;
 
     spanfunc();
+    r_stats_spanpixels += x2 - x1 + 1;
+}
+
+//
+// R_InitPlanes
+// Only at game startup.
+//
+void R_InitPlanes(void)
+{
+    floorclip = malloc(SCREENWIDTH * sizeof(*floorclip));
+    ceilingclip = malloc(SCREENWIDTH * sizeof(*ceilingclip));
+
+    for (int i = 0; i < LOOKDIRS; i++)
+        yslopes[i] = malloc(SCREENHEIGHT * sizeof(*yslopes[i]));
+
+    cachedheight = calloc(SCREENHEIGHT, sizeof(*cachedheight));
+    cacheddistance = malloc(SCREENHEIGHT * sizeof(*cacheddistance));
+    cachedviewcosdistance = malloc(SCREENHEIGHT * sizeof(*cachedviewcosdistance));
+    cachedviewsindistance = malloc(SCREENHEIGHT * sizeof(*cachedviewsindistance));
+    cachedxstep = malloc(SCREENHEIGHT * sizeof(*cachedxstep));
+    cachedystep = malloc(SCREENHEIGHT * sizeof(*cachedystep));
+    spanstart = calloc(SCREENHEIGHT, sizeof(*spanstart));
 }
 
 //
@@ -149,14 +180,29 @@ void R_ClearPlanes(void)
         ceilingclip[i] = -1;
     }
 
-    for (int i = 0; i < MAXVISPLANES; i++)
-        for (*freehead = visplanes[i], visplanes[i] = NULL; *freehead;)
-            freehead = &(*freehead)->next;
+    if (visplanes)
+        for (unsigned int i = 0; i < numvisplanebuckets; i++)
+            for (*freehead = visplanes[i], visplanes[i] = NULL; *freehead;)
+                freehead = &(*freehead)->next;
+
+    // grow the hash if there were too many visplanes for it in the last frame
+    if (!visplanes || numvisplanes > numvisplanebuckets * MAXVISPLANELOAD)
+    {
+        while (numvisplanes > numvisplanebuckets * MAXVISPLANELOAD)
+            numvisplanebuckets <<= 1;
+
+        if (visplanes)
+            Z_Free(visplanes);
+
+        visplanes = Z_Calloc(numvisplanebuckets, sizeof(*visplanes), PU_STATIC, NULL);
+    }
+
+    numvisplanes = 0;
 
     lastopening = openings;
 
     // texture calculation
-    memset(cachedheight, 0, sizeof(cachedheight));
+    memset(cachedheight, 0, SCREENHEIGHT * sizeof(*cachedheight));
 }
 
 // New function, by Lee Killough
@@ -165,12 +211,17 @@ static visplane_t *new_visplane(unsigned int hash)
     visplane_t  *check = freetail;
 
     if (!check)
+    {
         check = calloc(1, sizeof(*check));
+        check->top = (unsigned int *)calloc((size_t)SCREENWIDTH * 2 + 4, sizeof(*check->top)) + 1;
+        check->bottom = check->top + SCREENWIDTH + 2;
+    }
     else if (!(freetail = freetail->next))
         freehead = &freetail;
 
     check->next = visplanes[hash];
     visplanes[hash] = check;
+    numvisplanes++;
     return check;
 }
 
@@ -215,7 +266,6 @@ visplane_t *R_FindPlane(fixed_t height, int picnum, int lightlevel, fixed_t x, f
         check->yoffset = y;
     }
 
-    memset(check->top, UINT_MAX, sizeof(check->top));
     return check;
 }
 
@@ -234,7 +284,8 @@ visplane_t *R_DupPlane(const visplane_t *pl, int start, int stop)
     new_pl->left = start;
     new_pl->right = stop;
 
-    memset(new_pl->top, UINT_MAX, sizeof(new_pl->top));
+    // only the columns in use need clearing
+    memset(&new_pl->top[start], UINT_MAX, (stop - start + 1) * sizeof(*new_pl->top));
 
     return new_pl;
 }
@@ -276,6 +327,18 @@ visplane_t *R_CheckPlane(visplane_t *pl, int start, int stop)
 
     if (x > intrh)
     {
+        // clear the columns the plane is being widened to cover
+        if (pl->left > pl->right)
+            memset(&pl->top[unionl], UINT_MAX, (unionh - unionl + 1) * sizeof(*pl->top));
+        else
+        {
+            if (unionl < pl->left)
+                memset(&pl->top[unionl], UINT_MAX, (pl->left - unionl) * sizeof(*pl->top));
+
+            if (unionh > pl->right)
+                memset(&pl->top[pl->right + 1], UINT_MAX, (unionh - pl->right) * sizeof(*pl->top));
+        }
+
         pl->left = unionl;
         pl->right = unionh;
         return pl;
@@ -290,10 +353,7 @@ visplane_t *R_CheckPlane(visplane_t *pl, int start, int stop)
 //
 static void R_MakeSpans(visplane_t *pl)
 {
-    // spanstart holds the start of a plane span
-    // initialized to 0 at start
-    static int  spanstart[SCREENHEIGHT];
-    int         stop = pl->right + 1;
+    int stop = pl->right + 1;
 
     xoffset = pl->xoffset;
     yoffset = pl->yoffset;
@@ -335,42 +395,67 @@ static void R_MakeSpans(visplane_t *pl)
 // 1 cycle per 32 units (2 in 64)
 #define SWIRLFACTOR2    (8192 / 32)
 
-static int  offsets[1024 * 4096];
+// offset into a flat of each texel of its distorted frame in the current tic
+static unsigned short   offsets[4096];
+static int              offsetstic = -1;
+
+// the distorted frame of each liquid flat, and the tic it was made in
+static byte             **distortedflats;
+static int              *distortedflattics;
+
+int                     r_liquid_warps;
+
+//
+// R_UpdateDistortedFlatOffsets
+// The sine waves that distort a flat each run along a single axis, so rather
+//  than precalculating the offsets for every tic, they are added together once per
+//  tic from a handful of sines for each row and column.
+//
+static void R_UpdateDistortedFlatOffsets(void)
+{
+    const int   i = (leveltime & 1023) * SPEED;
+    int         rowx[64], rowy[64];
+    int         columnx[64], columny[64];
+
+    for (int j = 0; j < 64; j++)
+    {
+        rowx[j] = (finesine[(j * SWIRLFACTOR + i * 5 + 900) & 8191] * AMP) >> FRACBITS;
+        rowy[j] = j + 128 + ((finesine[(j * SWIRLFACTOR2 + i * 4 + 1200) & 8191] * AMP2) >> FRACBITS);
+        columnx[j] = j + 128 + ((finesine[(j * SWIRLFACTOR2 + i * 4 + 300) & 8191] * AMP2) >> FRACBITS);
+        columny[j] = (finesine[(j * SWIRLFACTOR + i * 3 + 700) & 8191] * AMP) >> FRACBITS;
+    }
+
+    for (int y = 0; y < 64; y++)
+        for (int x = 0; x < 64; x++)
+            offsets[(y << 6) + x] = (((rowy[y] + columny[x]) & 63) << 6) + ((rowx[y] + columnx[x]) & 63);
+
+    offsetstic = leveltime;
+}
 
 //
 // R_DistortedFlat
 // Generates a distorted flat from a normal one using a two-dimensional sine wave pattern.
-// [crispy] Optimized to precalculate offsets
+// Each flat is only distorted once per tic, however many visplanes use it.
 //
 static byte *R_DistortedFlat(int flatnum)
 {
-    static byte distortedflat[4096];
-    static int  prevleveltime = -1;
-    static int  prevflatnum = -1;
-    static byte *normalflat;
-    static int  *offset;
+    byte    *distortedflat = distortedflats[flatnum];
 
-    if (prevleveltime != leveltime)
+    if (distortedflattics[flatnum] != leveltime)
     {
-        offset = &offsets[(leveltime & 1023) << 12];
-        prevleveltime = leveltime;
+        const byte  *normalflat = lumpinfo[firstflat + flatnum]->cache;
 
-        if (prevflatnum != flatnum)
-        {
-            normalflat = lumpinfo[firstflat + flatnum]->cache;
-            prevflatnum = flatnum;
-        }
+        if (!distortedflat)
+            distortedflat = distortedflats[flatnum] = Z_Malloc(4096, PU_STATIC, NULL);
 
-        for (int i = 0; i < 4096; i++)
-            distortedflat[i] = normalflat[offset[i]];
-    }
-    else if (prevflatnum != flatnum)
-    {
-        normalflat = lumpinfo[firstflat + flatnum]->cache;
-        prevflatnum = flatnum;
+        if (offsetstic != leveltime)
+            R_UpdateDistortedFlatOffsets();
 
         for (int i = 0; i < 4096; i++)
-            distortedflat[i] = normalflat[offset[i]];
+            distortedflat[i] = normalflat[offsets[i]];
+
+        distortedflattics[flatnum] = leveltime;
+        r_liquid_warps++;
     }
 
     return distortedflat;
@@ -382,22 +467,11 @@ static byte *R_DistortedFlat(int flatnum)
 //
 void R_InitDistortedFlats(void)
 {
-    for (int i = 0, *offset = offsets; i < 1024 * SPEED; i += SPEED, offset += 4096)
-        for (int y = 0; y < 64; y++)
-            for (int x = 0; x < 64; x++)
-            {
-                int x1, y1;
-                int sinvalue, sinvalue2;
-
-                sinvalue = finesine[(y * SWIRLFACTOR + i * 5 + 900) & 8191];
-                sinvalue2 = finesine[(x * SWIRLFACTOR2 + i * 4 + 300) & 8191];
-                x1 = x + 128 + ((sinvalue * AMP) >> FRACBITS) + ((sinvalue2 * AMP2) >> FRACBITS);
-                sinvalue = finesine[(x * SWIRLFACTOR + i * 3 + 700) & 8191];
-                sinvalue2 = finesine[(y * SWIRLFACTOR2 + i * 4 + 1200) & 8191];
-                y1 = y + 128 + ((sinvalue * AMP) >> FRACBITS) + ((sinvalue2 * AMP2) >> FRACBITS);
+    distortedflats = Z_Calloc(numflats, sizeof(*distortedflats), PU_STATIC, NULL);
+    distortedflattics = Z_Malloc(numflats * sizeof(*distortedflattics), PU_STATIC, NULL);
 
-                offset[(y << 6) + x] = ((y1 & 63) << 6) + (x1 & 63);
-            }
+    for (int i = 0; i < numflats; i++)
+        distortedflattics[i] = -1;
 }
 
 //
@@ -406,8 +480,13 @@ void R_InitDistortedFlats(void)
 //
 void R_DrawPlanes(void)
 {
-    for (int i = 0; i < MAXVISPLANES; i++)
-        for (visplane_t *pl = visplanes[i]; pl; pl = pl->next)
+    r_liquid_warps = 0;
+
+    for (unsigned int i = 0; i < numvisplanebuckets; i++)
+    {
+        int chain = 0;
+
+        for (visplane_t *pl = visplanes[i]; pl; pl = pl->next, chain++)
             if (pl->left <= pl->right)
             {
                 int picnum = pl->picnum;
@@ -479,6 +558,7 @@ void R_DrawPlanes(void)
                                 dc_source = R_GetTextureColumn(tex_patch,
                                     (((an + xtoviewangle[x]) ^ flip) >> ANGLETOSKYSHIFT) + skyoffset);
                                 skycolfunc();
+                                r_stats_skycolumns++;
                             }
                 }
                 else
@@ -490,4 +570,8 @@ void R_DrawPlanes(void)
                     R_MakeSpans(pl);
                 }
             }
+
+        r_stats_visplanes += chain;
+        r_stats_visplanes_chain = MAX(r_stats_visplanes_chain, chain);
+    }
 }
@@ -44,12 +44,13 @@
 
 // Visplane related.
 extern int      *lastopening;
-extern int      floorclip[SCREENWIDTH];
-extern int      ceilingclip[SCREENWIDTH];
+extern int      *floorclip;
+extern int      *ceilingclip;
 extern fixed_t  *yslope;
-extern fixed_t  yslopes[LOOKDIRS][SCREENHEIGHT];
+extern fixed_t  *yslopes[LOOKDIRS];
 extern int      *openings;  // dropoff overflow
 
+void R_InitPlanes(void);
 void R_ClearPlanes(void);
 void R_DrawPlanes(void);
 visplane_t *R_FindPlane(fixed_t height, int picnum, int lightlevel, fixed_t x, fixed_t y);
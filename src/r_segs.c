@@ -210,6 +210,7 @@ static void R_BlastMaskedSegColumn(const rcolumn_t *column)
                 dc_texturefrac = dc_texturemid - (topdelta << FRACBITS) + FixedMul((dc_yl - centery) << FRACBITS, dc_iscale);
                 dc_source = pixels + topdelta;
                 colfunc();
+                r_stats_maskedposts++;
             }
     }
 }
@@ -364,6 +365,7 @@ static void R_RenderSegLoop(void)
             // single sided line
             dc_yl = yl;
             dc_yh = yh;
+            r_stats_walldraws++;
 
             if (missingmidtexture)
                 R_DrawColorColumn();
@@ -399,6 +401,7 @@ static void R_RenderSegLoop(void)
                 {
                     dc_yl = yl;
                     dc_yh = mid;
+                    r_stats_walldraws++;
 
                     if (missingtoptexture)
                         R_DrawColorColumn();
@@ -439,6 +442,7 @@ static void R_RenderSegLoop(void)
                 {
                     dc_yl = mid;
                     dc_yh = yh;
+                    r_stats_walldraws++;
 
                     if (missingbottomtexture)
                         R_DrawColorColumn();
@@ -495,7 +499,7 @@ static fixed_t R_ScaleFromGlobalAngle(angle_t visangle)
 {
     const int       angle = ANG90 + visangle;
     const int       den = FixedMul(rw_distance, finesine[angle >> ANGLETOFINESHIFT]);
-    const fixed_t   num = FixedMul(projection, finesine[(angle + viewangle - rw_normalangle) >> ANGLETOFINESHIFT]);
+    const fixed_t   num = FixedMul(projectiony, finesine[(angle + viewangle - rw_normalangle) >> ANGLETOFINESHIFT]);
 
     return (den > (num >> FRACBITS) ? BETWEEN(256, FixedDiv(num, den), max_rwscale) : max_rwscale);
 }
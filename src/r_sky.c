@@ -116,12 +116,12 @@ void R_InitSkyMap(void)
         else
             skytexturemid = 0;
 
-        skyiscale = (fixed_t)(((uint64_t)FRACUNIT * SCREENWIDTH * 200) / ((uint64_t)viewwidth * SCREENHEIGHT)) * skyheight / SKYSTRETCH_HEIGHT;
+        skyiscale = (fixed_t)(((uint64_t)FRACUNIT * SCREENWIDTH * 200) / ((uint64_t)scaledviewwidth * SCREENHEIGHT)) * skyheight / SKYSTRETCH_HEIGHT;
     }
     else
     {
         skytexturemid = ORIGINALHEIGHT / 2 * FRACUNIT;
-        skyiscale = (fixed_t)(((uint64_t)FRACUNIT * SCREENWIDTH * 200) / ((uint64_t)viewwidth * SCREENHEIGHT));
+        skyiscale = (fixed_t)(((uint64_t)FRACUNIT * SCREENWIDTH * 200) / ((uint64_t)scaledviewwidth * SCREENHEIGHT));
     }
 
     if (consoleactive)
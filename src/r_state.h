@@ -67,6 +67,7 @@ extern int          scaledviewwidth;
 extern int          viewheight;
 
 extern int          firstflat;
+extern int          numflats;
 
 // for global animation
 extern int          *flattranslation;
@@ -139,7 +140,7 @@ extern player_t     *viewplayer;
 extern angle_t      clipangle;
 
 extern int          viewangletox[FINEANGLES / 2];
-extern angle_t      xtoviewangle[SCREENWIDTH + 1];
+extern angle_t      *xtoviewangle;
 
 extern visplane_t   *floorplane;
 extern visplane_t   *ceilingplane;
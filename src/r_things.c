@@ -60,12 +60,32 @@
 //
 fixed_t                 pspritescale;
 fixed_t                 pspriteiscale;
+fixed_t                 pspritexscale;
+fixed_t                 pspritexiscale;
 
 static lighttable_t     **spritelights;         // killough 1/25/98 made static
 
 // constant arrays used for psprite clipping and initializing clipping
-int                     negonearray[SCREENWIDTH];
-int                     viewheightarray[SCREENWIDTH];
+int                     *negonearray;
+int                     *viewheightarray;
+
+// clipping of each sprite and blood splat against drawsegs
+static int              *cliptop;
+static int              *clipbot;
+
+// Drawsegs that can clip sprites are binned by the columns they cover, DRAWSEGBINWIDTH
+//  columns to a bin, so each sprite and blood splat only needs to test those that overlap it.
+//
+#define DRAWSEGBINSHIFT 5
+#define DRAWSEGBINWIDTH (1 << DRAWSEGBINSHIFT)
+
+static int              *drawsegbinstart;
+static int              *drawsegbinnext;
+static int              *drawsegbins;
+static int              *drawsegsinrange;
+static int              numbinneddrawsegs;
+static int              maxdrawsegbins;
+static int              maxdrawsegsinrange;
 
 //
 // INITIALIZATION FUNCTIONS
@@ -80,9 +100,7 @@ static spriteframe_t    sprtemp[MAX_SPRITE_FRAMES];
 static int              maxframe;
 
 static dboolean         drawshadows;
-static dboolean         interpolatesprites;
 static dboolean         invulnerable;
-static dboolean         pausesprites;
 static fixed_t          floorheight;
 
 dboolean                r_liquid_clipsprites = r_liquid_clipsprites_default;
@@ -307,6 +325,13 @@ static bloodsplatvissprite_t    bloodsplatvissprites[r_bloodsplats_max_max];
 //
 void R_InitSprites(void)
 {
+    negonearray = malloc(SCREENWIDTH * sizeof(*negonearray));
+    viewheightarray = malloc(SCREENWIDTH * sizeof(*viewheightarray));
+    cliptop = malloc(SCREENWIDTH * sizeof(*cliptop));
+    clipbot = malloc(SCREENWIDTH * sizeof(*clipbot));
+    drawsegbinstart = malloc((((SCREENWIDTH - 1) >> DRAWSEGBINSHIFT) + 2) * sizeof(*drawsegbinstart));
+    drawsegbinnext = malloc((((SCREENWIDTH - 1) >> DRAWSEGBINSHIFT) + 1) * sizeof(*drawsegbinnext));
+
     for (int i = 0; i < SCREENWIDTH; i++)
         negonearray[i] = -1;
 
@@ -361,7 +386,10 @@ static void R_BlastShadowColumn(const rcolumn_t *column)
 
         if ((dc_yh = MIN((int)(((topscreen + (int64_t)spryscale * post->length) >> FRACBITS) / 10 + shadowshift), dc_floorclip)) >= 0)
             if ((dc_yl = MAX(dc_ceilingclip, (int)(((topscreen + FRACUNIT) >> FRACBITS) / 10 + shadowshift))) <= dc_yh)
+            {
                 shadowcolfunc();
+                r_stats_spriteposts++;
+            }
     }
 }
 
@@ -382,6 +410,7 @@ static void R_BlastSpriteColumn(const rcolumn_t *column)
                 dc_texturefrac = dc_texturemid - (topdelta << FRACBITS) + FixedMul((dc_yl - centery) << FRACBITS, dc_iscale);
                 dc_source = pixels + topdelta;
                 colfunc();
+                r_stats_spriteposts++;
             }
     }
 }
@@ -403,6 +432,7 @@ static void R_BlastPlayerSpriteColumn(const rcolumn_t *column)
                 dc_texturefrac = dc_texturemid - (topdelta << FRACBITS) + FixedMul((dc_yl - centery) << FRACBITS, dc_iscale);
                 dc_source = pixels + topdelta;
                 colfunc();
+                r_stats_spriteposts++;
             }
     }
 }
@@ -420,7 +450,10 @@ static void R_BlastBloodSplatColumn(const rcolumn_t *column)
 
         if ((dc_yh = MIN((int)((topscreen + (int64_t)spryscale * post->length) >> FRACBITS), dc_floorclip)) >= 0)
             if ((dc_yl = MAX(dc_ceilingclip, (int)((topscreen + FRACUNIT) >> FRACBITS))) <= dc_yh)
+            {
                 colfunc();
+                r_stats_spriteposts++;
+            }
     }
 }
 
@@ -530,7 +563,7 @@ static void R_DrawPlayerVisSprite(const vissprite_t *vis)
     sprtopscreen = (int64_t)centeryfrac - FixedMul(dc_texturemid, pspritescale);
     fuzzpos = 0;
 
-    for (dc_x = vis->x1; dc_x <= x2; dc_x++, frac += pspriteiscale)
+    for (dc_x = vis->x1; dc_x <= x2; dc_x++, frac += pspritexiscale)
     {
         const rcolumn_t *column = R_GetPatchColumnClamped(patch, frac >> FRACBITS);
 
@@ -578,6 +611,7 @@ static void R_ProjectSprite(mobj_t *thing)
 {
     fixed_t         tx;
     fixed_t         xscale;
+    fixed_t         yscale;
     int             x1;
     int             x2;
     spriteframe_t   *sprframe;
@@ -599,11 +633,11 @@ static void R_ProjectSprite(mobj_t *thing)
         return;
 
     // [AM] Interpolate between current and last position, if prudent.
-    if (thing->interpolate && interpolatesprites)
+    if (interpolatesprites)
     {
-        fx = thing->oldx + FixedMul(thing->x - thing->oldx, fractionaltic);
-        fy = thing->oldy + FixedMul(thing->y - thing->oldy, fractionaltic);
-        fz = thing->oldz + FixedMul(thing->z - thing->oldz, fractionaltic);
+        fx = thing->interpx;
+        fy = thing->interpy;
+        fz = thing->interpz;
     }
     else
     {
@@ -662,9 +696,10 @@ static void R_ProjectSprite(mobj_t *thing)
     }
 
     xscale = FixedDiv(projection, tz);
+    yscale = FixedDiv(projectiony, tz);
 
-    if (fz > viewz + FixedDiv(viewheight << FRACBITS, xscale)
-        || gzt < viewz - FixedDiv((viewheight << FRACBITS) - viewheight, xscale))
+    if (fz > viewz + FixedDiv(viewheight << FRACBITS, yscale)
+        || gzt < viewz - FixedDiv((viewheight << FRACBITS) - viewheight, yscale))
         return;
 
     // calculate edges of the shape
@@ -709,13 +744,13 @@ static void R_ProjectSprite(mobj_t *thing)
     vis->heightsec = heightsec;
 
     vis->mobj = thing;
-    vis->scale = xscale;
+    vis->scale = yscale;
     vis->gx = fx;
     vis->gy = fy;
     vis->gz = floorheight;
     vis->gzt = gzt;
 
-    if (drawshadows && (flags2 & MF2_CASTSHADOW) && xscale >= FRACUNIT / 4)
+    if (drawshadows && (flags2 & MF2_CASTSHADOW) && yscale >= FRACUNIT / 4)
         vis->shadowpos = floorheight + thing->shadowoffset - viewz;
     else
         vis->shadowpos = 1;
@@ -736,7 +771,7 @@ static void R_ProjectSprite(mobj_t *thing)
         if (r_liquid_bob)
             clipfeet += animatedliquiddiff;
 
-        vis->footclip = FixedMul(height - clipfeet, xscale);
+        vis->footclip = FixedMul(height - clipfeet, yscale);
     }
     else
     {
@@ -784,13 +819,14 @@ static void R_ProjectSprite(mobj_t *thing)
     else if ((frame & FF_FULLBRIGHT) && (rot <= 4 || rot >= 12 || thing->info->fullbright))
         vis->colormap = fullcolormap;           // full bright
     else                                        // diminished light
-        vis->colormap = spritelights[MIN(xscale >> LIGHTSCALESHIFT, MAXLIGHTSCALE - 1)];
+        vis->colormap = spritelights[MIN(yscale >> LIGHTSCALESHIFT, MAXLIGHTSCALE - 1)];
 }
 
 static void R_ProjectBloodSplat(const bloodsplat_t *splat)
 {
     fixed_t                 tx;
     fixed_t                 xscale;
+    fixed_t                 yscale;
     int                     x1;
     int                     x2;
     bloodsplatvissprite_t   *vis;
@@ -805,9 +841,11 @@ static void R_ProjectBloodSplat(const bloodsplat_t *splat)
     if (tz < MINZ)
         return;
 
-    if ((xscale = FixedDiv(projection, tz)) < FRACUNIT / 4)
+    if ((yscale = FixedDiv(projectiony, tz)) < FRACUNIT / 4)
         return;
 
+    xscale = FixedDiv(projection, tz);
+
     tx = FixedMul(tr_x, viewsin) - FixedMul(tr_y, viewcos);
 
     // too far off the side?
@@ -833,7 +871,7 @@ static void R_ProjectBloodSplat(const bloodsplat_t *splat)
     // store information in a vissprite
     vis = &bloodsplatvissprites[num_bloodsplatvissprite++];
 
-    vis->scale = xscale;
+    vis->scale = yscale;
     vis->gx = fx;
     vis->gy = fy;
 
@@ -885,7 +923,7 @@ static void R_ProjectBloodSplat(const bloodsplat_t *splat)
     vis->patch = splat->patch;
 
     // get light level
-    vis->colormap = (fixedcolormap ? fixedcolormap : spritelights[MIN(xscale >> LIGHTSCALESHIFT, MAXLIGHTSCALE - 1)]);
+    vis->colormap = (fixedcolormap ? fixedcolormap : spritelights[MIN(yscale >> LIGHTSCALESHIFT, MAXLIGHTSCALE - 1)]);
 }
 
 //
@@ -957,15 +995,15 @@ static void R_DrawPlayerSprite(pspdef_t *psp, dboolean invisibility, dboolean al
 
     // calculate edges of the shape
     tx = psp->sx - ORIGINALWIDTH / 2 * FRACUNIT - (altered && !vanilla ? spriteoffset[lump] : newspriteoffset[lump]);
-    x1 = (centerxfrac + FRACUNIT / 2 + FixedMul(tx, pspritescale)) >> FRACBITS;
-    x2 = ((centerxfrac + FRACUNIT / 2 + FixedMul(tx + spritewidth[lump], pspritescale)) >> FRACBITS) - 1;
+    x1 = (centerxfrac + FRACUNIT / 2 + FixedMul(tx, pspritexscale)) >> FRACBITS;
+    x2 = ((centerxfrac + FRACUNIT / 2 + FixedMul(tx + spritewidth[lump], pspritexscale)) >> FRACBITS) - 1;
 
     // store information in a vissprite
     vis->texturemid = (BASEYCENTER << FRACBITS) + FRACUNIT / 4 - (psp->sy + ABS(viewplayer->bounce) - spritetopoffset[lump]);
 
     vis->x1 = MAX(0, x1);
     vis->x2 = MIN(x2, viewwidth - 1);
-    vis->startfrac = (vis->x1 > x1 ? pspriteiscale * (vis->x1 - x1) : 0);
+    vis->startfrac = (vis->x1 > x1 ? pspritexiscale * (vis->x1 - x1) : 0);
     vis->patch = lump;
 
     // interpolation for weapon bobbing
@@ -1118,18 +1156,130 @@ void R_DrawPlayerSprites(void)
     }
 }
 
+//
+int         r_drawsegtests;
+int         r_drawsegtests_skipped;
+
+static void R_BinDrawSegs(void)
+{
+    int numbins = ((viewwidth - 1) >> DRAWSEGBINSHIFT) + 1;
+    int *next = drawsegbinnext;
+    int total = 0;
+    int numdrawsegs = 0;
+
+    memset(next, 0, numbins * sizeof(*next));
+
+    for (drawseg_t *ds = drawsegs; ds < ds_p; ds++)
+        if (ds->silhouette || ds->maskedtexturecol)
+        {
+            for (int bin = ds->x1 >> DRAWSEGBINSHIFT; bin <= ds->x2 >> DRAWSEGBINSHIFT; bin++)
+                next[bin]++;
+
+            numdrawsegs++;
+        }
+
+    for (int bin = 0; bin < numbins; bin++)
+    {
+        const int   count = next[bin];
+
+        drawsegbinstart[bin] = next[bin] = total;
+        total += count;
+    }
+
+    drawsegbinstart[numbins] = total;
+
+    if (total > maxdrawsegbins)
+    {
+        maxdrawsegbins = MAX(total, maxdrawsegbins * 2);
+        drawsegbins = I_Realloc(drawsegbins, maxdrawsegbins * sizeof(*drawsegbins));
+    }
+
+    numbinneddrawsegs = numdrawsegs;
+
+    if (numdrawsegs > maxdrawsegsinrange)
+    {
+        maxdrawsegsinrange = MAX(numdrawsegs, maxdrawsegsinrange * 2);
+        drawsegsinrange = I_Realloc(drawsegsinrange, maxdrawsegsinrange * sizeof(*drawsegsinrange));
+    }
+
+    for (drawseg_t *ds = drawsegs; ds < ds_p; ds++)
+        if (ds->silhouette || ds->maskedtexturecol)
+            for (int bin = ds->x1 >> DRAWSEGBINSHIFT; bin <= ds->x2 >> DRAWSEGBINSHIFT; bin++)
+                drawsegbins[next[bin]++] = (int)(ds - drawsegs);
+}
+
+//
+// R_GetDrawSegsInRange
+// Get the indices of the drawsegs in the bins from x1 to x2 in the order they were
+//  stored. A drawseg in more than one of those bins is only included from the first.
+//  Each bin is already in order, so the bins are merged.
+//
+static int R_GetDrawSegsInRange(const int x1, const int x2, const int **indices)
+{
+    const int   bin1 = x1 >> DRAWSEGBINSHIFT;
+    const int   bin2 = x2 >> DRAWSEGBINSHIFT;
+    int         count = 0;
+
+    if (bin1 == bin2)
+    {
+        *indices = drawsegbins + drawsegbinstart[bin1];
+        count = drawsegbinstart[bin1 + 1] - drawsegbinstart[bin1];
+    }
+    else
+    {
+        // the bins' counts aren't needed once they are filled, so reuse them as cursors
+        int *cursor = drawsegbinnext;
+
+        for (int bin = bin1; bin <= bin2; bin++)
+            cursor[bin] = drawsegbinstart[bin];
+
+        while (true)
+        {
+            int nextbin = -1;
+            int index = INT_MAX;
+
+            for (int bin = bin1; bin <= bin2; bin++)
+            {
+                // skip drawsegs that start in an earlier bin in the range
+                if (bin > bin1)
+                    while (cursor[bin] < drawsegbinstart[bin + 1]
+                        && (drawsegs[drawsegbins[cursor[bin]]].x1 >> DRAWSEGBINSHIFT) < bin)
+                        cursor[bin]++;
+
+                if (cursor[bin] < drawsegbinstart[bin + 1] && drawsegbins[cursor[bin]] < index)
+                {
+                    index = drawsegbins[cursor[bin]];
+                    nextbin = bin;
+                }
+            }
+
+            if (nextbin == -1)
+                break;
+
+            drawsegsinrange[count++] = index;
+            cursor[nextbin]++;
+        }
+
+        *indices = drawsegsinrange;
+    }
+
+    r_drawsegtests += count;
+    r_drawsegtests_skipped += numbinneddrawsegs - count;
+
+    return count;
+}
+
 //
 // R_DrawBloodSplatSprite
 //
 static void R_DrawBloodSplatSprite(const bloodsplatvissprite_t *splat)
 {
-    int             cliptop[SCREENWIDTH];
-    int             clipbot[SCREENWIDTH];
     const int       x1 = splat->x1;
     const int       x2 = splat->x2;
     const fixed_t   scale = splat->scale;
     const fixed_t   gx = splat->gx;
     const fixed_t   gy = splat->gy;
+    const int       *indices;
 
     // initialize the clipping arrays
     for (int i = x1; i <= x2; i++)
@@ -1140,12 +1290,13 @@ static void R_DrawBloodSplatSprite(const bloodsplatvissprite_t *splat)
 
     // Scan drawsegs from end to start for obscuring segs.
     // The first drawseg that has a greater scale is the clip seg.
-    for (drawseg_t *ds = ds_p; ds-- > drawsegs;)
+    for (int i = R_GetDrawSegsInRange(x1, x2, &indices); i-- > 0;)
     {
-        const int   silhouette = ds->silhouette;
+        const drawseg_t *ds = &drawsegs[indices[i]];
+        const int       silhouette = ds->silhouette;
 
         // determine if the drawseg obscures the bloodsplat
-        if (ds->x1 > x2 || ds->x2 < x1 || (!silhouette && !ds->maskedtexturecol))
+        if (ds->x1 > x2 || ds->x2 < x1)
             continue;       // does not cover bloodsplat
 
         if (ds->maxscale < scale || (ds->minscale < scale && !R_PointOnSegSide(gx, gy, ds->curline)))
@@ -1174,74 +1325,120 @@ static void R_DrawBloodSplatSprite(const bloodsplatvissprite_t *splat)
     R_DrawBloodSplatVisSprite(splat);
 }
 
-static void msort(vissprite_t **s, vissprite_t **t, unsigned int n)
+//
+// Vissprites and blood splats are sorted by scale using a stable LSD radix
+//  sort. Each is sorted as a 64-bit key with its scale in the upper 32 bits and
+//  its index in the lower 32 bits, so small counts can be insertion sorted on the
+//  whole key with the same result. The buffers only ever grow.
+//
+#define RADIXBITS       11
+#define RADIXSIZE       (1 << RADIXBITS)
+#define INSERTIONSORT   64
+
+static uint64_t         *sortkeys;
+static uint64_t         *sortkeys_temp;
+static unsigned int     num_sortkeys_alloc;
+
+static void R_ReserveSortKeys(unsigned int n)
 {
-    if (n >= 16)
+    if (n > num_sortkeys_alloc)
     {
-        unsigned int    n1 = n / 2;
-        unsigned int    n2 = n - n1;
-        vissprite_t     **s1 = s;
-        vissprite_t     **s2 = s + n1;
-        vissprite_t     **d = t;
+        num_sortkeys_alloc = MAX(n, num_sortkeys_alloc * 2);
+        sortkeys = I_Realloc(sortkeys, num_sortkeys_alloc * sizeof(*sortkeys));
+        sortkeys_temp = I_Realloc(sortkeys_temp, num_sortkeys_alloc * sizeof(*sortkeys_temp));
+    }
+}
 
-        msort(s1, t, n1);
-        msort(s2, t, n2);
+static const uint64_t *R_SortByScale(unsigned int n)
+{
+    uint64_t    *src = sortkeys;
+    uint64_t    *dest = sortkeys_temp;
 
-        while ((*s1)->scale > (*s2)->scale ? (*d++ = *s1++, --n1) : (*d++ = *s2++, --n2));
+    if (n < INSERTIONSORT)
+    {
+        for (unsigned int i = 1; i < n; i++)
+        {
+            const uint64_t  temp = src[i];
+            unsigned int    j = i;
 
-        if (n2)
-            memcpy(d, s2, n2 * sizeof(void *));
-        else
-            memcpy(d, s1, n1 * sizeof(void *));
+            for (; j && src[j - 1] > temp; j--)
+                src[j] = src[j - 1];
+
+            src[j] = temp;
+        }
 
-        memcpy(s, t, n * sizeof(void *));
+        return src;
     }
-    else
-        for (unsigned int i = 1; i < n; i++)
-        {
-            vissprite_t *temp = s[i];
 
-            if (s[i - 1]->scale < temp->scale)
-            {
-                int j = i;
+    for (int shift = 32; shift < 64; shift += RADIXBITS)
+    {
+        unsigned int    count[RADIXSIZE] = { 0 };
+        unsigned int    total = 0;
+        uint64_t        *temp;
 
-                while ((s[j] = s[j - 1])->scale < temp->scale && --j);
+        for (unsigned int i = 0; i < n; i++)
+            count[(src[i] >> shift) & (RADIXSIZE - 1)]++;
 
-                s[j] = temp;
-            }
+        // skip this digit if every key shares it
+        if (count[(src[0] >> shift) & (RADIXSIZE - 1)] == n)
+            continue;
+
+        for (int i = 0; i < RADIXSIZE; i++)
+        {
+            const unsigned int  c = count[i];
+
+            count[i] = total;
+            total += c;
         }
+
+        for (unsigned int i = 0; i < n; i++)
+            dest[count[(src[i] >> shift) & (RADIXSIZE - 1)]++] = src[i];
+
+        temp = src;
+        src = dest;
+        dest = temp;
+    }
+
+    return src;
 }
 
+//
+// R_SortVisSprites
+// sort vissprites from back to front
+//
 static void R_SortVisSprites(void)
 {
-    if (num_vissprite)
+    static unsigned int num_vissprite_ptrs;
+    const uint64_t      *sorted;
+
+    if (!num_vissprite)
+        return;
+
+    if (num_vissprite_ptrs < num_vissprite_alloc)
     {
-        int                 i = num_vissprite;
-        static unsigned int num_vissprite_ptrs;
+        num_vissprite_ptrs = num_vissprite_alloc;
+        vissprite_ptrs = I_Realloc(vissprite_ptrs, num_vissprite_ptrs * sizeof(*vissprite_ptrs));
+    }
 
-        if (num_vissprite_ptrs < num_vissprite * 2)
-        {
-            free(vissprite_ptrs);
-            num_vissprite_ptrs = num_vissprite_alloc * 2;
-            vissprite_ptrs = malloc(num_vissprite_ptrs * sizeof(*vissprite_ptrs));
-        }
+    R_ReserveSortKeys(num_vissprite);
 
-        while (--i >= 0)
-            vissprite_ptrs[i] = vissprites + i;
+    for (unsigned int i = 0; i < num_vissprite; i++)
+        sortkeys[i] = ((uint64_t)(unsigned int)vissprites[i].scale << 32) | i;
 
-        msort(vissprite_ptrs, vissprite_ptrs + num_vissprite, num_vissprite);
-    }
+    sorted = R_SortByScale(num_vissprite);
+
+    for (unsigned int i = 0; i < num_vissprite; i++)
+        vissprite_ptrs[i] = vissprites + (uint32_t)sorted[i];
 }
 
 static void R_DrawSprite(const vissprite_t *spr)
 {
-    int             cliptop[SCREENWIDTH];
-    int             clipbot[SCREENWIDTH];
     const int       x1 = spr->x1;
     const int       x2 = spr->x2;
     const fixed_t   scale = spr->scale;
     const fixed_t   gx = spr->gx;
     const fixed_t   gy = spr->gy;
+    const int       *indices;
 
     // initialize the clipping arrays
     for (int i = x1; i <= x2; i++)
@@ -1252,12 +1449,13 @@ static void R_DrawSprite(const vissprite_t *spr)
 
     // Scan drawsegs from end to start for obscuring segs.
     // The first drawseg that has a greater scale is the clip seg.
-    for (drawseg_t *ds = ds_p; ds-- > drawsegs;)
+    for (int i = R_GetDrawSegsInRange(x1, x2, &indices); i-- > 0;)
     {
+        drawseg_t   *ds = &drawsegs[indices[i]];
         const int   silhouette = ds->silhouette;
 
         // determine if the drawseg obscures the sprite
-        if (ds->x1 > x2 || ds->x2 < x1 || (!silhouette && !ds->maskedtexturecol))
+        if (ds->x1 > x2 || ds->x2 < x1)
             continue;       // does not cover sprite
 
         if (ds->maxscale < scale || (ds->minscale < scale && !R_PointOnSegSide(gx, gy, ds->curline)))
@@ -1349,24 +1547,33 @@ static void R_DrawSprite(const vissprite_t *spr)
 //
 void R_DrawMasked(void)
 {
-    int i;
-
-    pausesprites = (menuactive || paused || consoleactive || freeze);
-    interpolatesprites = (vid_capfps != TICRATE && !pausesprites);
     invulnerable = (viewplayer->fixedcolormap == INVERSECOLORMAP && r_translucency);
+    r_stats_vissprites = num_vissprite;
 
-    // draw all blood splats
-    i = num_bloodsplatvissprite;
+    r_drawsegtests = 0;
+    r_drawsegtests_skipped = 0;
+    R_BinDrawSegs();
 
-    while (i-- > 0)
-        R_DrawBloodSplatSprite(&bloodsplatvissprites[i]);
+    // draw all blood splats back to front
+    if (num_bloodsplatvissprite)
+    {
+        const uint64_t  *sorted;
+
+        R_ReserveSortKeys(num_bloodsplatvissprite);
+
+        for (unsigned int i = 0; i < num_bloodsplatvissprite; i++)
+            sortkeys[i] = ((uint64_t)(unsigned int)bloodsplatvissprites[i].scale << 32) | i;
+
+        sorted = R_SortByScale(num_bloodsplatvissprite);
+
+        for (unsigned int i = 0; i < num_bloodsplatvissprite; i++)
+            R_DrawBloodSplatSprite(&bloodsplatvissprites[(uint32_t)sorted[i]]);
+    }
 
     R_SortVisSprites();
 
     // draw all other vissprites back to front
-    i = num_vissprite;
-
-    while (i-- > 0)
+    for (unsigned int i = 0; i < num_vissprite; i++)
         R_DrawSprite(vissprite_ptrs[i]);
 
     // render any remaining masked mid textures
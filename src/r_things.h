@@ -41,8 +41,8 @@
 
 // Constant arrays used for psprite clipping
 //  and initializing clipping.
-extern int      negonearray[SCREENWIDTH];
-extern int      viewheightarray[SCREENWIDTH];
+extern int      *negonearray;
+extern int      *viewheightarray;
 
 // vars for R_DrawMaskedColumn
 extern int      *mfloorclip;
@@ -52,6 +52,8 @@ extern int64_t  sprtopscreen;
 
 extern fixed_t  pspritescale;
 extern fixed_t  pspriteiscale;
+extern fixed_t  pspritexscale;
+extern fixed_t  pspritexiscale;
 
 extern dboolean r_playersprites;
 
@@ -132,8 +132,9 @@ static void InitSfxModule(void)
 {
     if (I_InitSound())
     {
-        C_Output("Sound effects are playing at a sample rate of %.1fkHz over %i channels%s.", SAMPLERATE / 1000.0f, s_channels,
-            (M_StringCompare(SDL_GetCurrentAudioDriver(), "directsound") ? " using the <i><b>DirectSound</b></i> API" : ""));
+        C_Output("Sound effects are playing at a sample rate of %.1fkHz over %i channels%s%s.", SAMPLERATE / 1000.0f, s_channels,
+            (M_StringCompare(SDL_GetCurrentAudioDriver(), "directsound") ? " using the <i><b>DirectSound</b></i> API" : ""),
+            (softmixer ? " with the software mixer" : ""));
         return;
     }
 
@@ -176,6 +177,13 @@ void S_Init(void)
         nosfx = true;
     }
 
+    if (M_CheckParm("-softmixer"))
+    {
+        C_Output("A <b>-softmixer</b> parameter was found on the command-line. Sound effects will be mixed using the "
+            "software mixer.");
+        softmixer = true;
+    }
+
     if (!nosfx)
     {
 #if defined(_WIN32)
@@ -273,7 +281,7 @@ void S_StopSounds(void)
             S_StopChannel(cnum);
 }
 
-static int S_GetMusicNum(void)
+static int S_GetMusicNum(int episode, int map)
 {
     static int mnum;
 
@@ -294,17 +302,17 @@ static int S_GetMusicNum(void)
                 mus_ddtblu
             };
 
-            mnum = nmus[(s_randommusic ? M_RandomIntNoRepeat(1, 9, mnum) : gamemap) - 1];
+            mnum = nmus[(s_randommusic ? M_RandomIntNoRepeat(1, 9, mnum) : map) - 1];
         }
         else
-            mnum = mus_runnin + (s_randommusic ? M_RandomIntNoRepeat(1, 32, mnum) : gamemap) - 1;
+            mnum = mus_runnin + (s_randommusic ? M_RandomIntNoRepeat(1, 32, mnum) : map) - 1;
     }
     else
     {
-        if (gameepisode < 4)
-            mnum = mus_e1m1 + (s_randommusic ? M_RandomIntNoRepeat(1, 21, mnum) : (gameepisode - 1) * 9 + gamemap) - 1;
-        else if (gameepisode == 5 && sigil)
-            mnum = mus_e5m1 + (s_randommusic ? M_RandomIntNoRepeat(1, 9, mnum) : gamemap) - 1;
+        if (episode < 4)
+            mnum = mus_e1m1 + (s_randommusic ? M_RandomIntNoRepeat(1, 21, mnum) : (episode - 1) * 9 + map) - 1;
+        else if (episode == 5 && sigil)
+            mnum = mus_e5m1 + (s_randommusic ? M_RandomIntNoRepeat(1, 9, mnum) : map) - 1;
         else
         {
             int spmus[] =
@@ -321,7 +329,7 @@ static int S_GetMusicNum(void)
                 mus_e1m9    // Tim          E4M9
             };
 
-            mnum = spmus[(s_randommusic ? M_RandomIntNoRepeat(1, 9, mnum) : gamemap) - 1];
+            mnum = spmus[(s_randommusic ? M_RandomIntNoRepeat(1, 9, mnum) : map) - 1];
         }
     }
 
@@ -338,7 +346,7 @@ void S_Start(void)
     // start new music for the level
     mus_paused = false;
 
-    S_ChangeMusic(S_GetMusicNum(), true, false, true);
+    S_ChangeMusic(S_GetMusicNum(gameepisode, gamemap), true, false, true);
 }
 
 // [crispy] removed map objects may finish their sounds
@@ -609,6 +617,9 @@ void S_UpdateSounds(void)
             // if channel is allocated but sound has stopped, free it
             S_StopChannel(cnum);
     }
+
+    // apply all changes in volume and separation at once
+    I_ApplySoundParams();
 }
 
 void S_SetMusicVolume(int volume)
@@ -700,6 +711,29 @@ void S_ChangeMusic(int music_id, dboolean looping, dboolean allowrestart, dboole
     }
 }
 
+//
+// Starts converting the music of a map in the background, before it is needed by S_ChangeMusic().
+//
+void S_PrecacheMapMusic(int episode, int map)
+{
+    musicinfo_t *music;
+    int         lumpnum;
+    char        namebuf[9];
+
+    // the music can't be known in advance if it's random
+    if (nomusic || s_randommusic || autosigil)
+        return;
+
+    music = &S_music[S_GetMusicNum(episode, map)];
+    M_snprintf(namebuf, sizeof(namebuf), "d_%s", music->name);
+
+    if ((lumpnum = P_GetMapMusic((episode - 1) * 10 + map)) <= 0
+        && (lumpnum = (music->lumpnum ? music->lumpnum : W_CheckNumForName(namebuf))) == -1)
+        return;
+
+    I_PrecacheSong(W_CacheLumpNum(lumpnum), W_LumpLength(lumpnum));
+}
+
 void S_StopMusic(void)
 {
     if (!mus_playing)
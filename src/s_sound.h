@@ -51,10 +51,13 @@
 #define MAX_MUSIC_VOLUME    MIX_MAX_VOLUME
 #define MAX_SFX_VOLUME      MIX_MAX_VOLUME
 
+extern dboolean     softmixer;
+
 dboolean I_InitSound(void);
 void I_ShutdownSound(void);
 dboolean CacheSFX(sfxinfo_t *sfxinfo);
 void I_UpdateSoundParams(int channel, int vol, int sep);
+void I_ApplySoundParams(void);
 int I_StartSound(sfxinfo_t *sfxinfo, int channel, int vol, int sep, int pitch);
 void I_StopSound(int channel);
 dboolean I_SoundIsPlaying(int channel);
@@ -65,6 +68,7 @@ void I_ShutdownMusic(void);
 void I_SetMusicVolume(int volume);
 void I_PauseSong(void);
 void I_ResumeSong(void);
+void I_PrecacheSong(void *data, int size);
 void *I_RegisterSong(void *data, int size);
 void I_UnRegisterSong(void *handle);
 void I_PlaySong(void *handle, dboolean looping);
@@ -109,6 +113,9 @@ void S_ChangeMusic(int music_id, dboolean looping, dboolean allowrestart, dboole
 // Stops the music fer sure.
 void S_StopMusic(void);
 
+// Start converting the music of a map in the background
+void S_PrecacheMapMusic(int episode, int map);
+
 // Stop and resume music, during game PAUSE.
 void S_PauseSound(void);
 void S_ResumeSound(void);
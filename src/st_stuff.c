@@ -390,11 +390,7 @@ static void ST_RefreshBackground(void)
 {
     if (st_statusbaron)
     {
-#if SCREENSCALE == 1
-        V_DrawSTBARPatch(ST_X, ORIGINALHEIGHT - ORIGINALSBARHEIGHT, sbar);
-        V_DrawPatch(ST_ARMSBGX + hacx * 4, ORIGINALHEIGHT - ORIGINALSBARHEIGHT, 0, armsbg);
-#else
-        if (STBAR >= 3 || r_detail == r_detail_low)
+        if (SCREENSCALE != DEFAULTSCREENSCALE || STBAR >= 3 || r_detail == r_detail_low)
         {
             V_DrawSTBARPatch(ST_X, ORIGINALHEIGHT - ORIGINALSBARHEIGHT, sbar);
             V_DrawPatch(ST_ARMSBGX + hacx * 4, ORIGINALHEIGHT - ORIGINALSBARHEIGHT, 0, armsbg);
@@ -404,7 +400,6 @@ static void ST_RefreshBackground(void)
             V_DrawBigPatch(ST_X, ST_Y, sbar2);
             V_DrawBigPatch(ST_ARMSBGX * 2, ST_Y, armsbg2);
         }
-#endif
     }
 }
 
@@ -1534,11 +1529,7 @@ static void ST_CreateWidgets(void)
     STlib_InitMultIcon(&w_keyboxes[1], ST_KEY1X + (STBAR >= 3), ST_KEY1Y, keys, &keyboxes[1]);
     STlib_InitMultIcon(&w_keyboxes[2], ST_KEY2X + (STBAR >= 3), ST_KEY2Y, keys, &keyboxes[2]);
 
-#if SCREENSCALE == 1
-    usesmallnums = false;
-#else
-    usesmallnums = ((!STYSNUM0 && STBAR == 2) || gamemode == shareware);
-#endif
+    usesmallnums = (SCREENSCALE == DEFAULTSCREENSCALE && ((!STYSNUM0 && STBAR == 2) || gamemode == shareware));
 
     // ammo count (all four kinds)
     STlib_InitNum(&w_ammo[am_clip], ST_AMMO0X, ST_AMMO0Y, shortnum, &viewplayer->ammo[am_clip], ST_AMMO0WIDTH);
@@ -57,14 +57,16 @@
 
 #define WHITE   4
 
+int             screenscale = DEFAULTSCREENSCALE;
+
 // Each screen is [SCREENWIDTH * SCREENHEIGHT];
 byte            *screens[5];
 
 static fixed_t  DX, DY;
 static fixed_t  DXI, DYI;
 
-static int      pixelwidth;
-static int      pixelheight;
+int             pixelwidth;
+int             pixelheight;
 char            *r_lowpixelsize = r_lowpixelsize_default;
 
 static char     screenshotfolder[MAX_PATH];
@@ -570,7 +572,7 @@ dboolean V_IsEmptyPatch(patch_t *patch)
     return true;
 }
 
-extern byte tempscreen[SCREENWIDTH * SCREENHEIGHT];
+extern byte *tempscreen;
 
 void V_DrawPatchToTempScreen(int x, int y, patch_t *patch)
 {
@@ -1449,7 +1451,7 @@ void V_LowGraphicDetail(void)
     {
         left = viewwindowx;
         top = viewwindowy * SCREENWIDTH;
-        width = viewwindowx + viewwidth;
+        width = viewwindowx + scaledviewwidth;
         height = (viewwindowy + viewheight) * SCREENWIDTH;
     }
 
@@ -1464,6 +1466,111 @@ void V_LowGraphicDetail(void)
         }
 }
 
+//
+// V_ExpandView
+// widen a view rendered viewwidth pixels across to scaledviewwidth, as it
+//  is when r_detail is low or r_dynamicresolution has lowered its width, also
+//  repeating rows as V_LowGraphicDetail() would in low detail
+//
+void V_ExpandView(void)
+{
+    const int       height = (viewwindowy + viewheight) * SCREENWIDTH;
+    const int       rowstep = (r_detail == r_detail_low ? pixelheight : SCREENWIDTH);
+    const fixed_t   xstep = FixedDiv(FRACUNIT, viewcolumnscale);
+
+    for (int y = viewwindowy * SCREENWIDTH; y < height; y += rowstep)
+    {
+        byte    *row = *screens + y + viewwindowx;
+
+        // work from the right so each column is read before it is overwritten
+        if (viewwidth != scaledviewwidth)
+            for (int x = scaledviewwidth - 1; x > 0; x--)
+                row[x] = row[(x * xstep) >> FRACBITS];
+
+        for (int yy = SCREENWIDTH; yy < rowstep && y + yy < height; yy += SCREENWIDTH)
+            memcpy(row + yy, row, scaledviewwidth);
+    }
+}
+
+// the row each diagonal and vertical pass of V_BlurScreen runs behind the horizontal
+//  passes, and the neighbor each pixel is averaged with
+static const struct
+{
+    int lag;
+    int dy;
+    int dx;
+} passes[] = {
+    { 1,  1,  1 },
+    { 1, -1, -1 },
+    { 2,  1,  0 },
+    { 2, -1,  0 },
+    { 3,  1, -1 },
+    { 3, -1,  1 }
+};
+
+// the two most recent rows of each pass, and a row to blur horizontally into
+static byte *blurrows;
+static byte *blurrow;
+
+#define BLURROW(pass, y)    (blurrows + ((pass) * 2 + ((y) & 1)) * SCREENWIDTH)
+
+//
+// V_BlurScreen
+// Blur a screen width pixels across and height pixels down in place by
+//  averaging each pixel with a neighbor in each of eight directions in turn. Rather
+//  than making eight passes over the whole screen, each pass runs a row or two behind
+//  the one before it in a single sweep, so the few rows they share stay in the cache.
+//
+void V_BlurScreen(byte *screen, int width, int height)
+{
+    for (int r = 0; r < height + 3; r++)
+    {
+        if (r < height)
+        {
+            byte    *src = screen + r * width;
+            byte    *dest = BLURROW(0, r);
+
+            for (int x = 0; x < width - 1; x++)
+                blurrow[x] = tinttab50[src[x] + (src[x + 1] << 8)];
+
+            blurrow[width - 1] = src[width - 1];
+            dest[0] = blurrow[0];
+
+            for (int x = 1; x < width - 1; x++)
+                dest[x] = tinttab50[blurrow[x] + (blurrow[x - 1] << 8)];
+
+            dest[width - 1] = blurrow[width - 1];
+        }
+
+        for (int i = 0; i < arrlen(passes); i++)
+        {
+            const int   y = r - passes[i].lag;
+            const int   dx = passes[i].dx;
+            const byte  *src;
+            byte        *dest;
+
+            if (y < 0 || y >= height)
+                continue;
+
+            src = BLURROW(i, y);
+            dest = (i == arrlen(passes) - 1 ? screen + y * width : BLURROW(i + 1, y));
+
+            if (y + passes[i].dy < 0 || y + passes[i].dy >= height)
+                memcpy(dest, src, width);
+            else
+            {
+                const byte  *neighbor = BLURROW(i, y + passes[i].dy) + dx;
+
+                dest[0] = src[0];
+                dest[width - 1] = src[width - 1];
+
+                for (int x = (dx < 0); x < width - (dx > 0); x++)
+                    dest[x] = tinttab50[src[x] + (neighbor[x] << 8)];
+            }
+        }
+    }
+}
+
 void V_InvertScreen(void)
 {
     int width = viewwindowx + viewwidth;
@@ -1498,6 +1605,9 @@ void V_Init(void)
     for (int i = 0; i < 4; i++)
         screens[i] = &base[i * SCREENWIDTH * SCREENHEIGHT];
 
+    blurrows = malloc(arrlen(passes) * 2 * SCREENWIDTH);
+    blurrow = malloc(SCREENWIDTH);
+
     DX = (SCREENWIDTH << FRACBITS) / ORIGINALWIDTH;
     DXI = (ORIGINALWIDTH << FRACBITS) / SCREENWIDTH;
     DY = (SCREENHEIGHT << FRACBITS) / ORIGINALHEIGHT;
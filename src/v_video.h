@@ -49,6 +49,9 @@
 // Screen 1 is an extra buffer.
 extern byte *screens[5];
 
+extern int  pixelwidth;
+extern int  pixelheight;
+
 // Allocates buffer screens, call before R_Init.
 void V_Init(void);
 
@@ -94,6 +97,8 @@ void V_DrawPixel(int x, int y, byte color, dboolean drawshadow);
 
 void GetPixelSize(dboolean reset);
 void V_LowGraphicDetail(void);
+void V_ExpandView(void);
+void V_BlurScreen(byte *screen, int width, int height);
 void V_InvertScreen(void);
 
 dboolean V_ScreenShot(void);
@@ -999,9 +999,14 @@ void WI_Ticker(void)
 
     // counter for general background animation
     if (++bcnt == 1)
+    {
         // intermission music
         S_ChangeMusic((gamemode == commercial ? mus_dm2int : mus_inter), true, false, false);
 
+        // start converting the next map's music while the intermission is shown
+        S_PrecacheMapMusic(wbs->epsd + 1, wbs->next + 1);
+    }
+
     WI_CheckForAccelerate();
 
     switch (state)